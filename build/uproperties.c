@@ -0,0 +1,363 @@
+#include <config.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <private.h>
+
+#define UNICODE_LAST_CHAR 0x10ffff
+
+// NOTE Code points are looked up in blocks of 1 << BLOCK_SHIFT.  This
+// keeps the index small while still letting most blocks be shared, see
+// the comment output by properties().
+#define BLOCK_SHIFT 7
+#define BLOCK_SIZE (1 << BLOCK_SHIFT)
+
+struct dataname {
+        const char *u;
+        const char *c;
+};
+
+static const struct dataname categories[] = {
+        { "Cc", "OTHER_CONTROL" },
+        { "Cf", "OTHER_FORMAT" },
+        { "Cn", "OTHER_NOT_ASSIGNED" },
+        { "Co", "OTHER_PRIVATE_USE" },
+        { "Cs", "OTHER_SURROGATE" },
+        { "Ll", "LETTER_LOWERCASE" },
+        { "Lm", "LETTER_MODIFIER" },
+        { "Lo", "LETTER_OTHER" },
+        { "Lt", "LETTER_TITLECASE" },
+        { "Lu", "LETTER_UPPERCASE" },
+        { "Mc", "MARK_SPACING_COMBINING" },
+        { "Me", "MARK_ENCLOSING" },
+        { "Mn", "MARK_NONSPACING" },
+        { "Nd", "NUMBER_DECIMAL_DIGIT" },
+        { "Nl", "NUMBER_LETTER" },
+        { "No", "NUMBER_OTHER" },
+        { "Pc", "PUNCTUATION_CONNECTOR" },
+        { "Pd", "PUNCTUATION_DASH" },
+        { "Pe", "PUNCTUATION_CLOSE" },
+        { "Pf", "PUNCTUATION_FINAL_QUOTE" },
+        { "Pi", "PUNCTUATION_INITIAL_QUOTE" },
+        { "Po", "PUNCTUATION_OTHER" },
+        { "Ps", "PUNCTUATION_OPEN" },
+        { "Sc", "SYMBOL_CURRENCY" },
+        { "Sk", "SYMBOL_MODIFIER" },
+        { "Sm", "SYMBOL_MATH" },
+        { "So", "SYMBOL_OTHER" },
+        { "Zl", "SEPARATOR_LINE" },
+        { "Zp", "SEPARATOR_PARAGRAPH" },
+        { "Zs", "SEPARATOR_SPACE" },
+};
+
+static const struct dataname word_breaks[] = {
+        { "ALetter",            "WORD_BREAK_ALETTER" },
+        { "CR",                 "WORD_BREAK_CR" },
+        { "Extend",             "WORD_BREAK_EXTEND" },
+        { "ExtendNumLet",       "WORD_BREAK_EXTENDNUMLET" },
+        { "Format",             "WORD_BREAK_FORMAT" },
+        { "Katakana",           "WORD_BREAK_KATAKANA" },
+        { "LF",                 "WORD_BREAK_LF" },
+        { "MidLetter",          "WORD_BREAK_MIDLETTER" },
+        { "MidNum",             "WORD_BREAK_MIDNUM" },
+        { "MidNumLet",          "WORD_BREAK_MIDNUMLET" },
+        { "Newline",            "WORD_BREAK_NEWLINE" },
+        { "Numeric",            "WORD_BREAK_NUMERIC" },
+        { "Other",              "WORD_BREAK_OTHER" },
+        { "Regional_Indicator", "WORD_BREAK_REGIONAL_INDICATOR" },
+};
+
+static const char *const widths[] = { "ZERO", "NARROW", "WIDE" };
+
+static void die(const char *message, ...) NORETURN;
+
+static void NMC_PRINTF(1, 2)
+die(const char *message, ...)
+{
+        va_list args;
+        va_start(args, message);
+        vfprintf(stderr, message, args);
+        va_end(args);
+        exit(EXIT_FAILURE);
+}
+
+static int
+datanamecmp(const void *a, const void *b)
+{
+        return strcmp((const char *)a, ((struct dataname *)b)->u);
+}
+
+// NOTE GCC suggests that data_name() is pure, as it only looks the name
+// up, but it exits through die() if it can’t find it, so it isn’t.
+#pragma GCC diagnostic push
+#ifdef HAVE_WSUGGESTATTRIBUTE_PURE
+#pragma GCC diagnostic ignored "-Wsuggest-attribute=pure"
+#endif
+static uint8_t
+data_name(const char *kind, const struct dataname *names, size_t n, const char *u)
+{
+        struct dataname *name = bsearch(u, names, n, sizeof(names[0]), datanamecmp);
+        if (name == NULL)
+                die("unknown Unicode %s name: %s\n", kind, u);
+        return name - names;
+}
+#pragma GCC diagnostic pop
+
+struct property {
+        uint8_t category;
+        uint8_t word_break;
+        uint8_t width;
+};
+
+static struct property data[UNICODE_LAST_CHAR + 1];
+
+static FILE *
+open_data(const char *path)
+{
+        FILE *file = fopen(path, "r");
+        if (file == NULL)
+                die("cannot open %s\n", path);
+        return file;
+}
+
+#define LAST " Last>"
+
+static bool
+is_last(const char *name)
+{
+        size_t length = strlen(name);
+        return length >= sizeof(LAST) - 1 &&
+                strcmp(name + length + 1 - sizeof(LAST), LAST) == 0;
+}
+
+static void
+read_categories(const char *path)
+{
+        uint8_t cn = data_name("category", categories, lengthof(categories), "Cn");
+        FILE *file = open_data(path);
+        char line[1024];
+        int previous = -1;
+        while (fgets(line, sizeof(line), file) != NULL) {
+                char *p = line;
+                int c = (int)strtol(strsep(&p, ";"), NULL, 16);
+                char *name = strsep(&p, ";");
+                char *u = strsep(&p, ";");
+                if (u == NULL)
+                        die("cannot parse line: %s\n", line);
+                if (c <= previous || c > UNICODE_LAST_CHAR)
+                        die("code point out of order: %04X\n", c);
+                uint8_t category = data_name("category", categories,
+                                             lengthof(categories), u);
+                if (c > previous + 1 && !is_last(name)) {
+                        for (int i = previous + 1; i < c; i++)
+                                data[i].category = cn;
+                        data[c].category = category;
+                } else
+                        for (int i = previous + 1; i <= c; i++)
+                                data[i].category = category;
+                previous = c;
+        }
+        fclose(file);
+        for (int i = previous + 1; i <= UNICODE_LAST_CHAR; i++)
+                data[i].category = cn;
+}
+
+// NOTE Calls f for each range of code points in the semicolon-separated
+// file at path, as found in the Unicode Character Database, with the
+// value given for it.
+static void
+read_ranges(const char *path, void (*f)(unsigned int, unsigned int, const char *))
+{
+        FILE *file = open_data(path);
+        char line[1024];
+        while (fgets(line, sizeof(line), file) != NULL) {
+                if (line[0] == '#' || line[0] == '\n')
+                        continue;
+                unsigned int s, e;
+                char padding[sizeof(line)], value[sizeof(line)];
+                if (sscanf(line, "%X..%X%[ ;]%[^ ]", &s, &e, padding, value) != 4) {
+                        if (sscanf(line, "%X%[ ;]%[^ ]", &s, padding, value) != 3)
+                                die("cannot parse line: %s\n", line);
+                        e = s;
+                }
+                if (s > e)
+                        die("start after end: %u > %u\n", s, e);
+                if (e > UNICODE_LAST_CHAR)
+                        die("end beyond last Unicode character: %u > %u\n", e,
+                            UNICODE_LAST_CHAR);
+                f(s, e, value);
+        }
+        fclose(file);
+}
+
+static void
+word_break(unsigned int s, unsigned int e, const char *value)
+{
+        uint8_t word_break = data_name("word break", word_breaks,
+                                       lengthof(word_breaks), value);
+        for (unsigned int i = s; i <= e; i++)
+                data[i].word_break = word_break;
+}
+
+static void
+east_asian_width(unsigned int s, unsigned int e, const char *value)
+{
+        if (*value == 'W' || *value == 'F')
+                for (unsigned int i = s; i <= e; i++)
+                        data[i].width = 2;
+}
+
+#define SOFT_HYPHEN 0x00ad
+#define ZERO_WIDTH_SPACE 0x200b
+
+// NOTE Nonspacing and enclosing marks and format characters, except for
+// the soft hyphen, which is visible when a line is broken at it, take up
+// no columns.  Neither do the medial vowels and final consonants of
+// conjoining Hangul, nor the zero width space.  Wide characters are wide
+// even if they’re also marks.
+static void
+read_widths(const char *path)
+{
+        const char *const zero[] = { "Cf", "Me", "Mn" };
+        for (int i = 0; i <= UNICODE_LAST_CHAR; i++) {
+                data[i].width = 1;
+                for (size_t j = 0; j < lengthof(zero); j++)
+                        if (strcmp(categories[data[i].category].u, zero[j]) == 0)
+                                data[i].width = 0;
+        }
+        data[SOFT_HYPHEN].width = 1;
+        for (int i = 0x1160; i < 0x1200; i++)
+                data[i].width = 0;
+        data[ZERO_WIDTH_SPACE].width = 0;
+        read_ranges(path, east_asian_width);
+}
+
+// NOTE Whether a character is visible on its own, see uc_issolid().
+static bool
+is_solid(const struct property *p)
+{
+        static const char *const unsolid[] = {
+                "Cc", "Cf", "Cs", "Co", "Cn", "Mc", "Me", "Mn", "Zl", "Zp", "Zs",
+        };
+        for (size_t i = 0; i < lengthof(unsolid); i++)
+                if (strcmp(categories[p->category].u, unsolid[i]) == 0)
+                        return false;
+        return true;
+}
+
+static struct property leaves[256];
+static size_t n_leaves;
+
+static uint8_t
+leaf(const struct property *p)
+{
+        for (size_t i = 0; i < n_leaves; i++)
+                if (memcmp(&leaves[i], p, sizeof(*p)) == 0)
+                        return i;
+        if (n_leaves == lengthof(leaves))
+                die("more than %zu distinct sets of properties\n", lengthof(leaves));
+        leaves[n_leaves] = *p;
+        return n_leaves++;
+}
+
+static uint8_t blocks[256][BLOCK_SIZE];
+static size_t n_blocks;
+static uint8_t block_index[(UNICODE_LAST_CHAR + 1) / BLOCK_SIZE];
+
+static void
+properties(void)
+{
+        for (size_t i = 0; i < lengthof(block_index); i++) {
+                uint8_t block[BLOCK_SIZE];
+                for (size_t j = 0; j < BLOCK_SIZE; j++)
+                        block[j] = leaf(&data[i * BLOCK_SIZE + j]);
+                size_t k;
+                for (k = 0; k < n_blocks; k++)
+                        if (memcmp(blocks[k], block, sizeof(block)) == 0)
+                                break;
+                if (k == n_blocks) {
+                        if (n_blocks == lengthof(blocks))
+                                die("more than %zu distinct blocks\n", lengthof(blocks));
+                        memcpy(blocks[n_blocks++], block, sizeof(block));
+                }
+                block_index[i] = k;
+        }
+        struct property missing = {
+                data_name("category", categories, lengthof(categories), "Cn"),
+                data_name("word break", word_breaks, lengthof(word_breaks), "Other"),
+                1
+        };
+        uint8_t missing_leaf = leaf(&missing);
+
+        printf("// NOTE Generated by build/uproperties.  %zu distinct sets of properties\n"
+               "// in %zu distinct blocks of %d code points take up %zu bytes.\n\n",
+               n_leaves, n_blocks, BLOCK_SIZE,
+               n_leaves * sizeof(uint16_t) + n_blocks * BLOCK_SIZE + lengthof(block_index));
+        puts("enum unicode_category {");
+        for (size_t i = 0; i < lengthof(categories); i++)
+                printf("\tUNICODE_%s,\n", categories[i].c);
+        puts("};\n\nenum unicode_word_break {");
+        for (size_t i = 0; i < lengthof(word_breaks); i++)
+                printf("\tUNICODE_%s,\n", word_breaks[i].c);
+        puts("};\n\nenum unicode_width {");
+        for (size_t i = 0; i < lengthof(widths); i++)
+                printf("\tUNICODE_WIDTH_%s,\n", widths[i]);
+        puts("};\n\n"
+             "#define UNICODE_PROPERTY_SOLID ((uint16_t)1 << 11)\n"
+             "#define UNICODE_PROPERTY(category, word_break, width, solid) \\\n"
+             "\t((uint16_t)((category) | (word_break) << 5 | (width) << 9 | \\\n"
+             "\t            ((solid) ? UNICODE_PROPERTY_SOLID : 0)))\n"
+             "#define UNICODE_PROPERTY_CATEGORY(p) ((enum unicode_category)((p) & 0x1f))\n"
+             "#define UNICODE_PROPERTY_WORD_BREAK(p) ((enum unicode_word_break)((p) >> 5 & 0xf))\n"
+             "#define UNICODE_PROPERTY_WIDTH(p) ((int)((p) >> 9 & 0x3))\n");
+        printf("#define UNICODE_PROPERTY_BLOCK_SHIFT %d\n"
+               "#define UNICODE_PROPERTY_MISSING ((uint8_t)%u)\n\n",
+               BLOCK_SHIFT, missing_leaf);
+        puts("static const uint16_t property_leaves[] = {");
+        for (size_t i = 0; i < n_leaves; i++)
+                printf("\tUNICODE_PROPERTY(UNICODE_%s, UNICODE_%s, UNICODE_WIDTH_%s, %s),\n",
+                       categories[leaves[i].category].c,
+                       word_breaks[leaves[i].word_break].c,
+                       widths[leaves[i].width],
+                       is_solid(&leaves[i]) ? "true" : "false");
+        printf("};\n\nstatic const uint8_t property_blocks[][%d] = {\n", BLOCK_SIZE);
+        for (size_t i = 0; i < n_blocks; i++) {
+                printf("\t{ // block %zu\n", i);
+                for (size_t j = 0; j < BLOCK_SIZE; j += 16) {
+                        putchar('\t');
+                        for (size_t k = j; k < j + 16; k++)
+                                printf("\t%u,", blocks[i][k]);
+                        putchar('\n');
+                }
+                puts("\t},");
+        }
+        puts("};\n\nstatic const uint8_t property_index[] = {");
+        for (size_t i = 0; i < lengthof(block_index); i += 8) {
+                printf("\t");
+                for (size_t j = i; j < i + 8; j++)
+                        printf("%3u,%s", block_index[j], j < i + 7 ? " " : "");
+                printf(" // U+%04zX\n", i * BLOCK_SIZE);
+        }
+        puts("};");
+}
+
+int
+main(int argc, char **argv)
+{
+        if (argc != 4)
+                die("Usage: %s UNICODEDATA WORDBREAKPROPERTY DERIVEDEASTASIANWIDTH\n",
+                    argv[0]);
+        read_categories(argv[1]);
+        uint8_t other = data_name("word break", word_breaks, lengthof(word_breaks), "Other");
+        for (int i = 0; i <= UNICODE_LAST_CHAR; i++)
+                data[i].word_break = other;
+        read_ranges(argv[2], word_break);
+        read_widths(argv[3]);
+        properties();
+        return EXIT_SUCCESS;
+}
@@ -10,3 +10,4 @@ bool buffer_append(struct buffer *buffer, const char *string, size_t length);
 bool buffer_append_c(struct buffer *buffer, char c, size_t n);
 bool buffer_read(struct buffer *buffer, int fd, size_t n);
 char *buffer_str(struct buffer *buffer);
+char *buffer_cstr(struct buffer *buffer);
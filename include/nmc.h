@@ -1,3 +1,6 @@
+#include <stdint.h>
+#include <string.h>
+
 #ifndef __attribute__
 #  if (! defined __GNUC__ || __GNUC__ < 2 || (__GNUC__ == 2 && __GNUC_MINOR__ < 5))
 #    define __attribute__(x) /* empty */
@@ -23,20 +26,55 @@ bool nmc_error_format(struct nmc_error *error, int number, const char *message,
 void nmc_error_release(struct nmc_error *error);
 
 struct nmc_output;
+struct iovec;
 
 typedef ssize_t (*nmc_output_write_fn)(struct nmc_output *, const char *,
                                        size_t, struct nmc_error *error);
+typedef ssize_t (*nmc_output_writev_fn)(struct nmc_output *,
+                                        const struct iovec *, int,
+                                        struct nmc_error *error);
 typedef bool (*nmc_output_close_fn)(struct nmc_output *, struct nmc_error *error);
 
+// NOTE An output may have a buffer of size bytes, length of which are in
+// use.  Writes that fit are copied into it; write is only called to flush
+// it or for writes too large to buffer.  The buffer is never filled
+// completely, so an output without a buffer never touches it.  An output
+// may also be able to write several strings at once, with writev, which
+// nmc_output_init() leaves unset.
 struct nmc_output {
         nmc_output_write_fn write;
         nmc_output_close_fn close;
+        char *buffer;
+        size_t size;
+        size_t length;
+        nmc_output_writev_fn writev;
 };
 
+void nmc_output_init(struct nmc_output *output, nmc_output_write_fn write,
+                     nmc_output_close_fn close);
 bool nmc_output_write_all(struct nmc_output *output, const char *string,
                           size_t length, size_t *written,
                           struct nmc_error *error);
+bool nmc_output_flush(struct nmc_output *output, struct nmc_error *error);
+bool nmc_output_writev(struct nmc_output *output, struct iovec *iov, size_t n,
+                       struct nmc_error *error);
 bool nmc_output_close(struct nmc_output *output, struct nmc_error *error);
+bool nmc_output_write_slow(struct nmc_output *output, const char *string,
+                           size_t length, struct nmc_error *error);
+
+// NOTE Only copying into the buffer is inlined, everywhere, including into
+// paths that the compiler considers too unlikely for it to pay off.
+static inline __attribute__((__always_inline__)) bool
+nmc_output_write(struct nmc_output *output, const char *string, size_t length,
+                 struct nmc_error *error)
+{
+        if (length < output->size - output->length) {
+                memcpy(output->buffer + output->length, string, length);
+                output->length += length;
+                return true;
+        }
+        return nmc_output_write_slow(output, string, length, error);
+}
 
 struct nmc_fd_output {
         struct nmc_output output;
@@ -48,12 +86,11 @@ void nmc_fd_output_init(struct nmc_fd_output *output, int fd);
 struct nmc_buffered_output {
         struct nmc_output output;
         struct nmc_output *real;
-        size_t length;
-        char buffer[4096];
 };
 
 void nmc_buffered_output_init(struct nmc_buffered_output *output,
-                              struct nmc_output *real);
+                              struct nmc_output *real, char *buffer,
+                              size_t size);
 
 enum nmc_node_type
 {
@@ -107,9 +144,15 @@ struct nmc_parent_node {
         struct nmc_node *children;
 };
 
+struct nmc_text {
+        struct nmc_text *next;
+        const char *string;
+        size_t length;
+};
+
 struct nmc_text_node {
         struct nmc_node node;
-        char *text;
+        struct nmc_text text;
 };
 
 struct nmc_node_datum {
@@ -117,14 +160,9 @@ struct nmc_node_datum {
         char *value;
 };
 
-struct nmc_node_data {
-        unsigned int references;
-        struct nmc_node_datum data[];
-};
-
 struct nmc_data_node {
         struct nmc_parent_node node;
-        struct nmc_node_data *data;
+        struct nmc_node_datum *data;
 };
 
 #define NMC_NODE_HAS_CHILDREN(node) ((node)->type < NMC_NODE_TYPE_TEXT)
@@ -138,11 +176,25 @@ bool nmc_node_traverse(struct nmc_node *node, nmc_node_traverse_fn enter,
                        struct nmc_error *error);
 void nmc_node_traverse_r(struct nmc_node *node, nmc_node_traverse_fn enter,
                          nmc_node_traverse_fn leave, void *closure);
-void nmc_node_free(struct nmc_node *node);
-bool nmc_node_xml(struct nmc_node *node, struct nmc_output *output,
+struct nmc_context;
+
+bool nmc_node_xml(const struct nmc_context *context, struct nmc_node *node,
+                  struct nmc_output *output, struct nmc_error *error);
+bool nmc_node_html(const struct nmc_context *context, struct nmc_node *node,
+                   struct nmc_output *output, struct nmc_error *error);
+bool nmc_node_man(const struct nmc_context *context, struct nmc_node *node,
+                  const char *const *params, struct nmc_output *output,
                   struct nmc_error *error);
 const char *nmc_node_name(struct nmc_node *node);
 
+// NOTE Writes node as XML, as nmc_node_xml() does, but with the top-level
+// children of a document serialized on up to threads threads at once, into
+// memory, before any of it is written.  Other nodes, small documents, and
+// any node without POSIX threads, are written in one piece.
+bool nmc_node_xml_parallel(const struct nmc_context *context,
+                           struct nmc_node *node, size_t threads,
+                           struct nmc_output *output, struct nmc_error *error);
+
 struct nmc_location {
         int first_line;
         int last_line;
@@ -162,9 +214,148 @@ extern struct nmc_parser_error nmc_parser_oom_error;
 
 void nmc_parser_error_free(struct nmc_parser_error *error);
 
+// NOTE Tracing the parser is switched on by setting this to non-zero.  It’s
+// Bison’s switch, which is global, so it traces all parsers, on all
+// threads, and must only be set before any of them start.
 extern int nmc_grammar_debug;
 
-bool nmc_initialize(struct nmc_error *error);
-void nmc_finalize(void);
+// NOTE No flags are defined yet, so flags must be 0.  Contexts don’t own
+// anything yet either, but must still be released, as they may come to.
+struct nmc_context {
+        unsigned int flags;
+};
+
+bool nmc_context_init(struct nmc_context *context, unsigned int flags,
+                      struct nmc_error *error);
+void nmc_context_release(struct nmc_context *context);
+
+struct nmc_arena;
+
+struct nmc_document {
+        struct nmc_node *root;
+        struct nmc_arena *arena;
+};
+
+enum nmc_parse_flags {
+        NMC_PARSE_REFERENCE_INPUT = 1 << 0,
+};
+
+struct nmc_document *nmc_parse(const struct nmc_context *context,
+                               const char *input, unsigned int flags,
+                               struct nmc_parser_error **errors);
+struct nmc_document *nmc_parse_n(const struct nmc_context *context,
+                                 const char *input, size_t length,
+                                 unsigned int flags,
+                                 struct nmc_parser_error **errors);
+void nmc_document_free(struct nmc_document *document);
+
+// NOTE Parses input as nmc_parse_n() does, but split at its top-level
+// sections into parts that are parsed on up to threads threads at once.
+// Small inputs, and inputs without POSIX threads, are parsed in one
+// piece.  Errors are the same as those of nmc_parse_n().
+struct nmc_document *nmc_parse_parallel(const struct nmc_context *context,
+                                        const char *input, size_t length,
+                                        unsigned int flags, size_t threads,
+                                        struct nmc_parser_error **errors);
+
+// NOTE Parses input and writes it to output as XML, as nmc_node_xml()
+// would, but without keeping the whole tree around.  Each top-level
+// section is written as soon as it and its footnotes have been parsed and
+// is then freed, so that memory use depends on the size of the largest
+// section rather than that of the document.  On failure, what has been
+// written is incomplete.  If parsing failed, errors is set to the errors,
+// otherwise it’s set to NULL and error is set.
+bool nmc_parse_xml(const struct nmc_context *context, const char *input,
+                   size_t length, unsigned int flags,
+                   struct nmc_output *output,
+                   struct nmc_parser_error **errors, struct nmc_error *error);
+
+// NOTE A parser that is fed its input piece by piece, as it arrives, and
+// parses as much of it as it can each time.  Pieces may end anywhere, even
+// in the middle of a character.  Feeding returns false once parsing has
+// failed, after which more input is ignored.  Finishing parses the rest
+// and frees the parser, returning the document or, as nmc_parse_n() does,
+// the errors.  Text is always copied, as NMC_PARSE_REFERENCE_INPUT can’t
+// be honored for input that the parser buffers itself.  Memory isn’t
+// bounded: all input fed so far is kept, to locate errors in, along with
+// the document, as for nmc_parse_n(), plus, until the top-level section
+// being parsed ends, the buffers that the input has outgrown.
+struct nmc_parser;
+
+struct nmc_parser *nmc_parser_new(const struct nmc_context *context,
+                                  unsigned int flags);
+bool nmc_parser_feed(struct nmc_parser *parser, const char *chunk,
+                     size_t length);
+struct nmc_document *nmc_parser_finish(struct nmc_parser *parser,
+                                       struct nmc_parser_error **errors);
+
+// NOTE An incremental parser keeps a text and its tree and, as the text
+// is edited, reparses only the top-level sections that an edit touches.
+// An edit replaces removed bytes at offset, which must all be in the text,
+// with length bytes of inserted.  Editing returns the root of the tree of
+// the text as edited or, as nmc_parse_n() does, the errors.  The tree is
+// owned by the parser and is valid until the next edit.  The text starts
+// out empty, and is always copied, as NMC_PARSE_REFERENCE_INPUT can’t be
+// honored for text that is edited.  If there isn’t memory for the edit,
+// it isn’t made, and the errors are nmc_parser_oom_error.
+struct nmc_incremental;
+
+struct nmc_incremental *nmc_incremental_new(const struct nmc_context *context,
+                                            unsigned int flags);
+struct nmc_node *nmc_incremental_edit(struct nmc_incremental *incremental,
+                                      size_t offset, size_t removed,
+                                      const char *inserted, size_t length,
+                                      struct nmc_parser_error **errors);
+void nmc_incremental_free(struct nmc_incremental *incremental);
+
+// NOTE A flat document holds the nodes of a tree in one array, in document
+// order, linked by 32-bit indexes instead of pointers, with all text and
+// attribute values in one pool of strings.  A node’s first child, if any,
+// directly follows it.  The offset of text nodes is where their text
+// starts in strings, that of data nodes where their data start in data.
+#define NMC_FLAT_NONE UINT32_MAX
+
+struct nmc_flat_node {
+        uint32_t children;
+        uint32_t next;
+        uint8_t type;
+        uint8_t name;
+        uint32_t offset;
+        uint32_t length;
+};
+
+struct nmc_flat_document {
+        struct nmc_flat_node *nodes;
+        size_t n;
+        struct nmc_node_datum *data;
+        char *strings;
+        size_t depth;
+};
+
+struct nmc_flat_document *nmc_flat_document_new(struct nmc_node *node,
+                                                struct nmc_error *error);
+void nmc_flat_document_free(struct nmc_flat_document *document);
+
+// NOTE Visits the nodes of a flat document in the order that
+// nmc_node_traverse() would, once when entering them and, for nested
+// nodes, once more when leaving them.
+struct nmc_flat_iterator {
+        const struct nmc_flat_document *document;
+        uint32_t *parents;
+        size_t n;
+        uint32_t next;
+};
+
+bool nmc_flat_iterator_init(struct nmc_flat_iterator *iterator,
+                            const struct nmc_flat_document *document,
+                            struct nmc_error *error);
+bool nmc_flat_iterator_next(struct nmc_flat_iterator *iterator,
+                            uint32_t *index, bool *enter);
+void nmc_flat_iterator_release(struct nmc_flat_iterator *iterator);
 
-struct nmc_node *nmc_parse(const char *input, struct nmc_parser_error **errors);
+bool nmc_flat_traverse(const struct nmc_flat_document *document,
+                       nmc_node_traverse_fn enter, nmc_node_traverse_fn leave,
+                       void *closure, struct nmc_error *error);
+bool nmc_flat_xml(const struct nmc_context *context,
+                  const struct nmc_flat_document *document,
+                  struct nmc_output *output, struct nmc_error *error);
@@ -0,0 +1,157 @@
+#include <config.h>
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc/list.h>
+
+#include <private.h>
+
+#include "arena.h"
+
+/* An arena hands out memory by bumping pointers through a list of blocks.
+ * Aligned objects are taken from the bottom of the current block and strings,
+ * which need no alignment, from the top.  Nothing is freed individually;
+ * releasing the arena releases everything allocated from it with one free()
+ * per block. */
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_ALIGNMENT alignof(max_align_t)
+
+struct block {
+        struct block *next;
+        alignas(max_align_t) char data[];
+};
+
+struct nmc_arena {
+        struct block *blocks;
+        char *p;
+        char *end;
+};
+
+static inline size_t
+align(size_t size)
+{
+        return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+static struct block *
+block_new(size_t size)
+{
+        if (size > SIZE_MAX - sizeof(struct block))
+                return NULL;
+        return malloc(sizeof(struct block) + size);
+}
+
+struct nmc_arena *
+nmc_arena_new(void)
+{
+        struct block *block = block_new(ARENA_BLOCK_SIZE);
+        if (block == NULL)
+                return NULL;
+        block->next = NULL;
+        struct nmc_arena *arena = (struct nmc_arena *)block->data;
+        arena->blocks = block;
+        arena->p = block->data + align(sizeof(struct nmc_arena));
+        arena->end = block->data + ARENA_BLOCK_SIZE;
+        return arena;
+}
+
+static void *
+alloc_slow(struct nmc_arena *arena, size_t size, bool top)
+{
+        // NOTE Large requests get a block of their own, and the current
+        // block stays current, so that its remainder isn’t wasted.  Blocks
+        // are still listed newest first, so that nmc_arena_release() can
+        // find those allocated since a mark.
+        if (size > ARENA_BLOCK_SIZE / 4) {
+                struct block *block = block_new(size);
+                if (block == NULL)
+                        return NULL;
+                block->next = arena->blocks;
+                arena->blocks = block;
+                return block->data;
+        }
+        struct block *block = block_new(ARENA_BLOCK_SIZE);
+        if (block == NULL)
+                return NULL;
+        block->next = arena->blocks;
+        arena->blocks = block;
+        arena->p = block->data;
+        arena->end = block->data + ARENA_BLOCK_SIZE;
+        if (top)
+                return arena->end -= size;
+        arena->p += size;
+        return block->data;
+}
+
+void *
+nmc_arena_alloc(struct nmc_arena *arena, size_t size)
+{
+        size = align(size);
+        if (UNLIKELY((size_t)(arena->end - arena->p) < size))
+                return alloc_slow(arena, size, false);
+        void *p = arena->p;
+        arena->p += size;
+        return p;
+}
+
+char *
+nmc_arena_strndup(struct nmc_arena *arena, const char *string, size_t length)
+{
+        if (length == SIZE_MAX)
+                return NULL;
+        char *s;
+        if (LIKELY((size_t)(arena->end - arena->p) > length))
+                s = arena->end -= length + 1;
+        else if ((s = alloc_slow(arena, length + 1, true)) == NULL)
+                return NULL;
+        s[length] = '\0';
+        if (length > 0)
+                memcpy(s, string, length);
+        return s;
+}
+
+struct nmc_arena_mark
+nmc_arena_mark(const struct nmc_arena *arena)
+{
+        return (struct nmc_arena_mark){ arena->blocks, arena->p, arena->end };
+}
+
+void
+nmc_arena_release(struct nmc_arena *arena, struct nmc_arena_mark mark)
+{
+        while (arena->blocks != mark.blocks) {
+                struct block *block = arena->blocks;
+                arena->blocks = block->next;
+                free(block);
+        }
+        arena->p = mark.p;
+        arena->end = mark.end;
+}
+
+// NOTE The blocks of other go after the current block of arena, which
+// stays current, and other, which lives in its first block, must not be
+// used again.  Marks taken of arena before can no longer be released to.
+void
+nmc_arena_adopt(struct nmc_arena *arena, struct nmc_arena *other)
+{
+        struct block *last = other->blocks;
+        while (last->next != NULL)
+                last = last->next;
+        last->next = arena->blocks->next;
+        arena->blocks->next = other->blocks;
+}
+
+void
+nmc_arena_free(struct nmc_arena *arena)
+{
+        if (arena == NULL)
+                return;
+        list_for_each_safe(struct block, p, n, arena->blocks)
+                free(p);
+}
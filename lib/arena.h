@@ -0,0 +1,17 @@
+struct nmc_arena *nmc_arena_new(void);
+void *nmc_arena_alloc(struct nmc_arena *arena, size_t size);
+char *nmc_arena_strndup(struct nmc_arena *arena, const char *string,
+                        size_t length);
+void nmc_arena_adopt(struct nmc_arena *arena, struct nmc_arena *other);
+void nmc_arena_free(struct nmc_arena *arena);
+
+// NOTE Where an arena was at some point, so that everything allocated from
+// it since can be released, leaving what was allocated before.
+struct nmc_arena_mark {
+        const void *blocks;
+        char *p;
+        char *end;
+};
+
+PURE struct nmc_arena_mark nmc_arena_mark(const struct nmc_arena *arena);
+void nmc_arena_release(struct nmc_arena *arena, struct nmc_arena_mark mark);
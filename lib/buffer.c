@@ -95,12 +95,20 @@ buffer_read(struct buffer *buffer, int fd, size_t n)
                         return false;
                 else if (r == 0)
                         return true;
-                buffer->length += r;
                 if (!available(buffer, buffer->length + 8192 + 1))
                         return false;
         }
 }
 
+char *
+buffer_cstr(struct buffer *buffer)
+{
+        if (!available(buffer, buffer->length + 1))
+                return NULL;
+        buffer->content[buffer->length] = '\0';
+        return buffer->content;
+}
+
 char *
 buffer_str(struct buffer *buffer)
 {
@@ -0,0 +1,130 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#ifdef HAVE_SSE2
+#  include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2
+#  include <immintrin.h>
+#endif
+
+#include <private.h>
+
+#include "escape.h"
+
+// NOTE Text escapes ‘&’, ‘<’, and ‘>’.  Attributes also escape ‘"’, TAB,
+// LF, and CR, so that they survive attribute-value normalization.  The
+// entity tables in node.c must agree with this.
+static inline bool
+is_special(unsigned char c, bool attribute)
+{
+        switch (c) {
+        case '&': case '<': case '>':
+                return true;
+        case '"': case '\t': case '\n': case '\r':
+                return attribute;
+        default:
+                return false;
+        }
+}
+
+const char *
+escape_find_scalar(const char *p, const char *end, bool attribute)
+{
+        while (p < end && !is_special((unsigned char)*p, attribute))
+                p++;
+        return p;
+}
+
+#ifdef HAVE_SSE2
+// NOTE ‘<’ and ‘>’ are 0x3c and 0x3e, the only bytes that equal ‘>’ when
+// or’d with 2.
+static inline __m128i
+sse2_special(__m128i v, bool attribute)
+{
+#define EQ(c) _mm_cmpeq_epi8(v, _mm_set1_epi8(c))
+        __m128i m = _mm_or_si128(EQ('&'),
+                                 _mm_cmpeq_epi8(_mm_or_si128(v, _mm_set1_epi8(2)),
+                                                _mm_set1_epi8('>')));
+        if (attribute)
+                m = _mm_or_si128(m, _mm_or_si128(_mm_or_si128(EQ('"'), EQ('\t')),
+                                                 _mm_or_si128(EQ('\n'), EQ('\r'))));
+#undef EQ
+        return m;
+}
+
+static inline PURE const char *
+find_sse2(const char *p, const char *end, bool attribute)
+{
+        for (; end - p >= 16; p += 16) {
+                int m = _mm_movemask_epi8(sse2_special(_mm_loadu_si128((const __m128i *)p),
+                                                       attribute));
+                if (m != 0)
+                        return p + __builtin_ctz((unsigned int)m);
+        }
+        return escape_find_scalar(p, end, attribute);
+}
+
+const char *
+escape_find_sse2(const char *p, const char *end, bool attribute)
+{
+        return attribute ? find_sse2(p, end, true) : find_sse2(p, end, false);
+}
+#endif
+
+#ifdef HAVE_AVX2
+#define AVX2 __attribute__((target("avx2")))
+
+static inline AVX2 __m256i
+avx2_special(__m256i v, bool attribute)
+{
+#define EQ(c) _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))
+        __m256i m = _mm256_or_si256(EQ('&'),
+                                    _mm256_cmpeq_epi8(_mm256_or_si256(v, _mm256_set1_epi8(2)),
+                                                      _mm256_set1_epi8('>')));
+        if (attribute)
+                m = _mm256_or_si256(m, _mm256_or_si256(_mm256_or_si256(EQ('"'), EQ('\t')),
+                                                       _mm256_or_si256(EQ('\n'), EQ('\r'))));
+#undef EQ
+        return m;
+}
+
+static inline AVX2 PURE const char *
+find_avx2(const char *p, const char *end, bool attribute)
+{
+        for (; end - p >= 32; p += 32) {
+                unsigned int m = (unsigned int)_mm256_movemask_epi8(
+                        avx2_special(_mm256_loadu_si256((const __m256i *)p), attribute));
+                if (m != 0)
+                        return p + __builtin_ctz(m);
+        }
+#ifdef HAVE_SSE2
+        return escape_find_sse2(p, end, attribute);
+#else
+        return escape_find_scalar(p, end, attribute);
+#endif
+}
+
+AVX2 const char *
+escape_find_avx2(const char *p, const char *end, bool attribute)
+{
+        return attribute ? find_avx2(p, end, true) : find_avx2(p, end, false);
+}
+
+#undef AVX2
+#endif
+
+const char *
+escape_find(const char *p, const char *end, bool attribute)
+{
+#ifdef HAVE_AVX2
+        if (__builtin_cpu_supports("avx2"))
+                return escape_find_avx2(p, end, attribute);
+#endif
+#ifdef HAVE_SSE2
+        return escape_find_sse2(p, end, attribute);
+#else
+        return escape_find_scalar(p, end, attribute);
+#endif
+}
@@ -0,0 +1,9 @@
+PURE const char *escape_find_scalar(const char *p, const char *end, bool attribute);
+#ifdef HAVE_SSE2
+PURE const char *escape_find_sse2(const char *p, const char *end, bool attribute);
+#endif
+#ifdef HAVE_AVX2
+PURE const char *escape_find_avx2(const char *p, const char *end, bool attribute);
+#endif
+
+PURE const char *escape_find(const char *p, const char *end, bool attribute);
@@ -0,0 +1,283 @@
+#include <config.h>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <nmc.h>
+#include <nmc/list.h>
+
+#include <private.h>
+
+#include "node.h"
+
+// NOTE A flat document is built in two traversals of the tree, the first
+// measuring it, the second filling in one allocation holding the header,
+// the data, the nodes, and the strings, in that order, so that each part
+// stays aligned.
+
+struct measure {
+        size_t nodes;
+        size_t data;
+        size_t strings;
+        size_t depth;
+        size_t n;
+};
+
+static bool
+measure_enter(struct nmc_node *node, struct measure *measure)
+{
+        measure->nodes++;
+        if (node->type == NMC_NODE_TYPE_DATA) {
+                for (struct nmc_node_datum *p = ((struct nmc_data_node *)node)->data;
+                     p->name != NULL; p++) {
+                        measure->data++;
+                        measure->strings += strlen(p->value) + 1;
+                }
+                measure->data++;
+        } else if (node->type == NMC_NODE_TYPE_TEXT) {
+                list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text)
+                        measure->strings += p->length;
+        }
+        if (NODE_IS_NESTED(node) && ++measure->n > measure->depth)
+                measure->depth = measure->n;
+        return true;
+}
+
+static bool
+measure_leave(UNUSED(struct nmc_node *node), struct measure *measure)
+{
+        measure->n--;
+        return true;
+}
+
+// NOTE Last holds, for each level from the root down to the node being
+// entered, the index of the most recently entered node on that level, or
+// NMC_FLAT_NONE if the level has none yet, so that the next node can be
+// linked to it as its sibling, or to its parent as its first child.
+struct fill {
+        struct nmc_flat_document *document;
+        uint32_t *last;
+        size_t n;
+        size_t data;
+        size_t strings;
+};
+
+static bool
+fill_enter(struct nmc_node *node, struct fill *fill)
+{
+        struct nmc_flat_document *document = fill->document;
+        uint32_t i = (uint32_t)document->n++;
+        struct nmc_flat_node *f = &document->nodes[i];
+        *f = (struct nmc_flat_node){
+                NMC_FLAT_NONE, NMC_FLAT_NONE, node->type, node->name, 0, 0
+        };
+        if (fill->last[fill->n] != NMC_FLAT_NONE)
+                document->nodes[fill->last[fill->n]].next = i;
+        else if (fill->n > 0)
+                document->nodes[fill->last[fill->n - 1]].children = i;
+        fill->last[fill->n] = i;
+
+        if (node->type == NMC_NODE_TYPE_DATA) {
+                f->offset = (uint32_t)fill->data;
+                for (struct nmc_node_datum *p = ((struct nmc_data_node *)node)->data;
+                     p->name != NULL; p++) {
+                        size_t length = strlen(p->value) + 1;
+                        char *value = document->strings + fill->strings;
+                        memcpy(value, p->value, length);
+                        fill->strings += length;
+                        document->data[fill->data++] =
+                                (struct nmc_node_datum){ p->name, value };
+                }
+                document->data[fill->data++] = (struct nmc_node_datum){ NULL, NULL };
+        } else if (node->type == NMC_NODE_TYPE_TEXT) {
+                f->offset = (uint32_t)fill->strings;
+                list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text) {
+                        memcpy(document->strings + fill->strings, p->string, p->length);
+                        fill->strings += p->length;
+                }
+                f->length = (uint32_t)(fill->strings - f->offset);
+        }
+
+        if (NODE_IS_NESTED(node))
+                fill->last[++fill->n] = NMC_FLAT_NONE;
+        return true;
+}
+
+static bool
+fill_leave(UNUSED(struct nmc_node *node), struct fill *fill)
+{
+        fill->n--;
+        return true;
+}
+
+struct nmc_flat_document *
+nmc_flat_document_new(struct nmc_node *node, struct nmc_error *error)
+{
+        struct measure measure = { 0, 0, 0, 0, 0 };
+        if (!nmc_node_traverse(node, (nmc_node_traverse_fn)measure_enter,
+                               (nmc_node_traverse_fn)measure_leave, &measure,
+                               error))
+                return NULL;
+        if (measure.nodes >= NMC_FLAT_NONE || measure.data > UINT32_MAX ||
+            measure.strings > UINT32_MAX) {
+                nmc_error_init(error, EOVERFLOW,
+                               "document too large for a flat document");
+                return NULL;
+        }
+
+        size_t data = sizeof(struct nmc_flat_document);
+        size_t nodes = data + measure.data * sizeof(struct nmc_node_datum);
+        size_t strings = nodes + measure.nodes * sizeof(struct nmc_flat_node);
+        struct nmc_flat_document *document = malloc(strings + measure.strings);
+        uint32_t *last = malloc((measure.depth + 1) * sizeof(*last));
+        if (document == NULL || last == NULL) {
+                free(last);
+                free(document);
+                nmc_error_oom(error);
+                return NULL;
+        }
+        *document = (struct nmc_flat_document){
+                (struct nmc_flat_node *)((char *)document + nodes), 0,
+                (struct nmc_node_datum *)((char *)document + data),
+                (char *)document + strings, measure.depth
+        };
+
+        struct fill fill = { document, last, 0, 0, 0 };
+        last[0] = NMC_FLAT_NONE;
+        bool r = nmc_node_traverse(node, (nmc_node_traverse_fn)fill_enter,
+                                   (nmc_node_traverse_fn)fill_leave, &fill,
+                                   error);
+        free(last);
+        if (!r) {
+                free(document);
+                return NULL;
+        }
+        return document;
+}
+
+void
+nmc_flat_document_free(struct nmc_flat_document *document)
+{
+        free(document);
+}
+
+bool
+nmc_flat_iterator_init(struct nmc_flat_iterator *iterator,
+                       const struct nmc_flat_document *document,
+                       struct nmc_error *error)
+{
+        iterator->document = document;
+        iterator->n = 0;
+        iterator->next = document->n > 0 ? 0 : NMC_FLAT_NONE;
+        iterator->parents = malloc((document->depth + 1) *
+                                   sizeof(*iterator->parents));
+        if (iterator->parents == NULL)
+                return nmc_error_oom(error);
+        return true;
+}
+
+// NOTE Nested nodes are pushed onto parents when entered and popped when
+// left, after their last child, whose next is NMC_FLAT_NONE.
+bool
+nmc_flat_iterator_next(struct nmc_flat_iterator *iterator, uint32_t *index,
+                       bool *enter)
+{
+        const struct nmc_flat_node *nodes = iterator->document->nodes;
+        uint32_t i = iterator->next;
+        if (i != NMC_FLAT_NONE) {
+                if (NODE_IS_NESTED(&nodes[i])) {
+                        iterator->parents[iterator->n++] = i;
+                        iterator->next = nodes[i].children;
+                } else {
+                        iterator->next = nodes[i].next;
+                }
+                *index = i;
+                *enter = true;
+                return true;
+        }
+        if (iterator->n == 0)
+                return false;
+        i = iterator->parents[--iterator->n];
+        iterator->next = nodes[i].next;
+        *index = i;
+        *enter = false;
+        return true;
+}
+
+void
+nmc_flat_iterator_release(struct nmc_flat_iterator *iterator)
+{
+        free(iterator->parents);
+}
+
+union view {
+        struct nmc_node node;
+        struct nmc_parent_node parent;
+        struct nmc_text_node text;
+        struct nmc_data_node data;
+};
+
+static struct nmc_node *
+view(const struct nmc_flat_document *document, uint32_t i, union view *view)
+{
+        const struct nmc_flat_node *node = &document->nodes[i];
+        view->node = (struct nmc_node){ NULL, node->type, node->name };
+        switch (node->type) {
+        case NMC_NODE_TYPE_PARENT:
+                view->parent.children = NULL;
+                break;
+        case NMC_NODE_TYPE_DATA:
+                view->data.node.children = NULL;
+                view->data.data = document->data + node->offset;
+                break;
+        case NMC_NODE_TYPE_TEXT:
+                view->text.text = (struct nmc_text){
+                        NULL, document->strings + node->offset, node->length
+                };
+                break;
+        default:
+                break;
+        }
+        return &view->node;
+}
+
+// NOTE Lets callbacks written for nmc_node_traverse() run on a flat
+// document.  Each node is presented as a node of the pointer tree that
+// lives from when it’s entered until it’s left, but without links to its
+// children or siblings, so only callbacks that don’t look at those, like
+// those of nmc_node_xml(), can be used.
+bool
+nmc_flat_traverse(const struct nmc_flat_document *document,
+                  nmc_node_traverse_fn enter, nmc_node_traverse_fn leave,
+                  void *closure, struct nmc_error *error)
+{
+        struct nmc_flat_iterator iterator;
+        if (!nmc_flat_iterator_init(&iterator, document, error))
+                return false;
+        union view *views = malloc((document->depth + 1) * sizeof(*views));
+        if (views == NULL) {
+                nmc_flat_iterator_release(&iterator);
+                return nmc_error_oom(error);
+        }
+        bool r = true;
+        uint32_t i;
+        bool entering;
+        while (r && nmc_flat_iterator_next(&iterator, &i, &entering)) {
+                if (entering) {
+                        size_t n = iterator.n -
+                                (NODE_IS_NESTED(&document->nodes[i]) ? 1 : 0);
+                        r = enter(view(document, i, &views[n]), closure);
+                } else {
+                        r = leave(&views[iterator.n].node, closure);
+                }
+        }
+        free(views);
+        nmc_flat_iterator_release(&iterator);
+        return r;
+}
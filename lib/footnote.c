@@ -0,0 +1,171 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <private.h>
+
+#include "footnote.h"
+
+// NOTE These match footnote definitions the way regexec() matched the
+// extended regular expressions given before each function: the longest
+// match wins, and, for that match, each part from left to right takes as
+// much as it can while leaving at least what the rest needs.  Only ‘ ’
+// is special; any other byte, including newlines, counts as text.
+
+static inline size_t
+spaces(const char *s, size_t i, size_t n)
+{
+        while (i < n && s[i] == ' ')
+                i++;
+        return i;
+}
+
+static inline size_t
+nonspaces(const char *s, size_t i, size_t n)
+{
+        while (i < n && s[i] != ' ')
+                i++;
+        return i;
+}
+
+// NOTE Returns the index after w, if s[i, n) begins with it, and 0
+// otherwise.
+static inline size_t
+after(const char *s, size_t i, size_t n, const char *w)
+{
+        size_t length = strlen(w);
+        return n - i >= length && memcmp(s + i, w, length) == 0 ? i + length : 0;
+}
+
+static inline void
+capture(struct footnote_capture *capture, const char *s, size_t begin,
+        size_t end)
+{
+        capture->string = s + begin;
+        capture->length = end - begin;
+}
+
+// ^Abbreviation +for +(.+)
+bool
+footnote_abbreviation(const char *s, size_t n,
+                      struct footnote_capture captures[1])
+{
+        size_t i = after(s, 0, n, "Abbreviation");
+        if (i == 0)
+                return false;
+        size_t j = spaces(s, i, n);
+        if (j == i || (i = after(s, j, n, "for")) == 0)
+                return false;
+        j = spaces(s, i, n);
+        if (j == i || (j == n && j - i < 2))
+                return false;
+        capture(&captures[0], s, j < n ? j : n - 1, n);
+        return true;
+}
+
+// ^(.+), +see +([^ ]+)( +\((.+)\))?
+//
+// Each “, see ” ends its match after its URI or after the last ‘)’ in s,
+// if the URI is followed by a parenthesized alternate.  The one that ends
+// last wins, and, of those, the last one, as that gives the longest title.
+bool
+footnote_inline_figure(const char *s, size_t n,
+                       struct footnote_capture captures[3])
+{
+        size_t close = n;
+        for (size_t i = n; i > 0; i--)
+                if (s[i - 1] == ')') {
+                        close = i - 1;
+                        break;
+                }
+        size_t end = 0;
+        for (size_t c = 1; c < n; c++) {
+                if (s[c] != ',')
+                        continue;
+                size_t i = spaces(s, c + 1, n);
+                if (i == c + 1 || (i = after(s, i, n, "see")) == 0)
+                        continue;
+                size_t u = spaces(s, i, n);
+                if (u == i || u == n)
+                        continue;
+                size_t v = nonspaces(s, u, n), e = v, open = spaces(s, v, n);
+                bool alternate = open > v && open < n && s[open] == '(' &&
+                        close < n && close > open + 1;
+                if (alternate)
+                        e = close + 1;
+                if (e < end)
+                        continue;
+                end = e;
+                capture(&captures[0], s, 0, c);
+                capture(&captures[1], s, u, v);
+                if (alternate)
+                        capture(&captures[2], s, open + 1, close);
+                else
+                        captures[2].string = NULL;
+        }
+        return end > 0;
+}
+
+// The title of “See +((the +)?(.+)(:| +at) +)?” in s[0, z), where s[z]
+// begins the separator.
+static bool
+link_see_title(const char *s, size_t z, struct footnote_capture *title)
+{
+        size_t h = spaces(s, 3, z);
+        if (h == z) {
+                if (z - 3 < 2)
+                        return false;
+                capture(title, s, z - 1, z);
+                return true;
+        }
+        size_t t = h, i = after(s, h, z, "the");
+        if (i > 0) {
+                size_t g = spaces(s, i, z);
+                if (g > i && g < z)
+                        t = g;
+                else if (g > i + 1)
+                        t = z - 1;
+        }
+        capture(title, s, t, z);
+        return true;
+}
+
+// ^(See +((the +)?(.+)(:| +at) +)?|(.+)(:| +at) +)([^ ]+)
+//
+// The URI is the last word that what precedes it matches the first group
+// for, and the separator, if any, is what precedes the spaces before it.
+bool
+footnote_link(const char *s, size_t n, struct footnote_capture captures[2])
+{
+        bool see = after(s, 0, n, "See ") > 0;
+        size_t e = n;
+        while (true) {
+                while (e > 0 && s[e - 1] == ' ')
+                        e--;
+                size_t b = e;
+                while (b > 0 && s[b - 1] != ' ')
+                        b--;
+                if (b == 0)
+                        return false;
+                size_t r = b;
+                while (r > 0 && s[r - 1] == ' ')
+                        r--;
+                size_t z = 0;
+                if (r >= 1 && s[r - 1] == ':')
+                        z = r - 1;
+                else if (r >= 4 && s[r - 2] == 'a' && s[r - 1] == 't' &&
+                         s[r - 3] == ' ')
+                        z = r - 3;
+                if (see && r == 3)
+                        captures[0].string = NULL;
+                else if (z == 0) {
+                        e = r;
+                        continue;
+                } else if (!see || z <= 3 || !link_see_title(s, z, &captures[0]))
+                        capture(&captures[0], s, 0, z);
+                capture(&captures[1], s, b, e);
+                return true;
+        }
+}
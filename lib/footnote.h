@@ -0,0 +1,11 @@
+struct footnote_capture {
+        const char *string;
+        size_t length;
+};
+
+bool footnote_abbreviation(const char *s, size_t n,
+                           struct footnote_capture captures[1]);
+bool footnote_inline_figure(const char *s, size_t n,
+                            struct footnote_capture captures[3]);
+bool footnote_link(const char *s, size_t n,
+                   struct footnote_capture captures[2]);
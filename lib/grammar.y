@@ -3,13 +3,16 @@
 
 #include <assert.h>
 #include <sys/types.h>
-#include <regex.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
 
 #include <nmc.h>
 #include <nmc/list.h>
@@ -17,21 +20,34 @@
 #include <private.h>
 
 #include <common/buffer.h>
+#include <lib/arena.h>
 #include <lib/error.h>
+#include <lib/footnote.h>
+#include <lib/node.h>
+#include <lib/structure.h>
 #include <lib/unicode.h>
 
-#define YYLTYPE struct nmc_location
-#define YY_LOCATION_PRINT(File, Loc) \
-        location_print(File, Loc)
+// NOTE Tokens only carry where in the input they begin and end.  Lines
+// and display columns are only needed for error messages, so they’re
+// worked out when one is reported, using an index of where each line
+// begins that’s built the first time that happens.
+struct span {
+        const char *begin;
+        const char *end;
+};
 
-static unsigned int
-location_print(FILE *out, YYLTYPE location)
-{
-        char *s = nmc_location_str(&location);
-        unsigned int r = fprintf(out, "%s", s);
-        free(s);
-        return r;
-}
+#define YYLTYPE struct span
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+        do { \
+                if (N) { \
+                        (Current).begin = YYRHSLOC(Rhs, 1).begin; \
+                        (Current).end = YYRHSLOC(Rhs, N).end; \
+                } else \
+                        (Current).begin = (Current).end = \
+                                YYRHSLOC(Rhs, 0).end; \
+        } while (0)
+#define YY_LOCATION_PRINT(File, Loc) \
+        location_print(File, parser, &(Loc))
 
 struct substring {
         const char *string;
@@ -43,26 +59,113 @@ struct nodes {
         struct nmc_node *last;
 };
 
+struct lines {
+        const char **begins;
+        size_t n;
+};
+
+struct id {
+        unsigned long hash;
+        char *string;
+};
+
+// NOTE Maps ids to values in an open-addressed table, probed linearly.
+// Entries are never removed one by one, only all at once, by starting a
+// new generation, so that clearing the table doesn’t depend on its size.
+struct table_entry {
+        struct id id;
+        unsigned int generation;
+        void *value;
+};
+
+struct table {
+        struct table_entry *entries;
+        size_t size;
+        size_t n;
+        unsigned int generation;
+};
+
+#define TABLE_INIT { NULL, 0, 0, 1 }
+
+// NOTE Where input that a push parser has moved to a larger buffer was,
+// so that locations still pointing into it can be found in the new one.
+// The buffer itself is freed once the top-level section being parsed when
+// it moved has been, after which nothing reads from it.  They’re not
+// allocated from the arena, as the lexer releases what it allocated from
+// it since it began lexing a token when it lexes it again, which may have
+// been before the input was moved.
+struct moved {
+        struct moved *next;
+        const char *input;
+        const char *end;
+        bool freed;
+};
+
+// NOTE Where a push parser was in the code block or the text of the
+// footnote beginning at p when it ran out of input, at the beginning of
+// the last line that it had seen all of, so that it continues from there,
+// rather than from p, once there is more.  A footnote’s text so far is the
+// first length bytes of the scratch buffer.  A code block’s is in node,
+// ending with last, which the next line is appended after, and what was
+// allocated for it, all up until mark, is kept.
+struct resume {
+        const char *p;
+        int type;
+        const char *begin;
+        const char *end;
+        struct nmc_text_node *node;
+        struct nmc_text *last;
+        size_t length;
+        struct nmc_arena_mark mark;
+};
+
+// NOTE When streaming, the title and the blocks before the first section
+// are kept until that section has been parsed and then written along with
+// it.  Each top-level section is then written and released, by rolling
+// the arena back to the mark, once its footnotes have been resolved.
+struct stream {
+        struct nmc_output *output;
+        struct nmc_error *error;
+        struct nmc_arena_mark mark;
+        struct nmc_node *title;
+        bool begun;
+        bool failed;
+};
+
 struct parser {
+        const struct nmc_context *context;
+        struct nmc_arena *arena;
+        unsigned int flags;
+        const char *input;
         const char *p;
-        YYLTYPE location;
+        const char *end;
+        const char *first;
+        struct lines lines;
+        struct structure structure;
         size_t indent;
         size_t dedents;
         bool bol;
         int want;
+        bool more;
+        bool starved;
+        struct resume resume;
+        struct moved *moved;
+        struct stream *stream;
         struct nmc_node *doc;
-        struct buffer buffer;
-        struct buffer_node *buffer_node;
-        struct anchor *anchors;
+        struct buffer scratch;
+        struct {
+                struct anchor *first;
+                struct table ids;
+        } anchors;
+        struct {
+                struct footnote *last;
+                struct table ids;
+        } footnotes;
         struct {
                 struct nmc_parser_error *first;
                 struct nmc_parser_error *last;
         } errors;
-};
-
-struct id {
-        unsigned long hash;
-        char *string;
+        struct nmc_parser_error *oom;
 };
 
 static PURE struct id
@@ -81,34 +184,92 @@ id_eq(const struct id *a, const struct id *b)
         return a->hash == b->hash && strcmp(a->string, b->string) == 0;
 }
 
-struct anchor {
-        struct anchor *next;
-        struct nmc_location location;
-        struct id id;
-        struct anchor_node *node;
-};
+// NOTE Ids are short and similar, so their hashes are mixed before their
+// low bits are used, which keeps probe sequences short.
+static PURE struct table_entry *
+table_probe(const struct table *table, const struct id *id)
+{
+        size_t mask = table->size - 1;
+        unsigned long h = id->hash;
+        h = (h ^ (h >> 16)) * 0x45d9f3bUL;
+        for (size_t i = h & mask; ; i = (i + 1) & mask) {
+                struct table_entry *e = &table->entries[i];
+                if (e->generation != table->generation || id_eq(&e->id, id))
+                        return e;
+        }
+}
 
-static char *
-mstrdup(const char *source, size_t n)
+static PURE void **
+table_find(const struct table *table, const struct id *id)
+{
+        if (table->n == 0)
+                return NULL;
+        struct table_entry *e = table_probe(table, id);
+        return e->generation == table->generation ? &e->value : NULL;
+}
+
+static bool
+table_grow(struct table *table)
+{
+        size_t size = table->size == 0 ? 16 : 2 * table->size;
+        struct table_entry *entries = calloc(size, sizeof(*entries));
+        if (entries == NULL)
+                return false;
+        struct table old = *table;
+        table->entries = entries;
+        table->size = size;
+        table->generation = 1;
+        for (size_t i = 0; i < old.size; i++)
+                if (old.entries[i].generation == old.generation) {
+                        struct table_entry *e = table_probe(table, &old.entries[i].id);
+                        *e = old.entries[i];
+                        e->generation = table->generation;
+                }
+        free(old.entries);
+        return true;
+}
+
+// NOTE Returns the value of id, which is NULL if it was just added, or NULL
+// if there’s no memory to add it.
+static void **
+table_insert(struct table *table, const struct id *id)
 {
-        char *target = malloc(n + 1);
-        if (target == NULL)
+        if (2 * (table->n + 1) > table->size && !table_grow(table))
                 return NULL;
-        target[n] = '\0';
-        return memcpy(target, source, n);
+        struct table_entry *e = table_probe(table, id);
+        if (e->generation != table->generation) {
+                e->id = *id;
+                e->generation = table->generation;
+                e->value = NULL;
+                table->n++;
+        }
+        return &e->value;
 }
 
 static void
-anchor_free1(struct anchor *anchor)
+table_clear(struct table *table)
 {
-        if (anchor == NULL)
+        if (table->n == 0)
                 return;
-        free(anchor->id.string);
-        /* NOTE anchor->node is either on the stack or in the tree, so we don’t
-         * need to free it here. */
-        free(anchor);
+        table->n = 0;
+        if (++table->generation == 0) {
+                memset(table->entries, 0, table->size * sizeof(*table->entries));
+                table->generation = 1;
+        }
 }
 
+// NOTE Anchors that haven’t been defined yet are kept in a list, most
+// recent first, so that the undefined ones can be reported in order, and
+// in a table, by id, each with a list of the anchors with the same id.
+struct anchor {
+        struct anchor *next;
+        struct anchor *previous;
+        struct anchor *same;
+        YYLTYPE location;
+        struct id id;
+        struct anchor_node *node;
+};
+
 struct footnote {
         struct footnote *next;
         YYLTYPE location;
@@ -116,25 +277,22 @@ struct footnote {
         struct nmc_data_node *node;
 };
 
-static void
-footnote_free1(struct footnote *footnote)
-{
-        free(footnote->id.string);
-        nmc_node_free((struct nmc_node *)footnote->node);
-        free(footnote);
-}
+static struct nmc_location parser_location(struct parser *parser,
+                                           const YYLTYPE *span);
 
-static void
-footnote_free(struct footnote *footnote)
+static unsigned int
+location_print(FILE *out, struct parser *parser, const YYLTYPE *span)
 {
-        list_for_each_safe(struct footnote, p, n, footnote)
-                footnote_free1(p);
+        struct nmc_location l = parser_location(parser, span);
+        char *s = nmc_location_str(&l);
+        unsigned int r = fprintf(out, "%s", s);
+        free(s);
+        return r;
 }
-
-static void nmc_node_unlink_and_free(struct nmc_node *node, struct parser *parser);
 %}
 
 %define api.pure full
+%define api.push-pull both
 %parse-param {struct parser *parser}
 %lex-param {struct parser *parser}
 %name-prefix "nmc_grammar_"
@@ -170,6 +328,7 @@ static void nmc_node_unlink_and_free(struct nmc_node *node, struct parser *parse
 %token ANCHORSEPARATOR "footnote anchor separator (⁺)"
 %token BEGINGROUP "beginning of grouped text ({…)"
 %token ENDGROUP "end of grouped text (…})"
+%token SECTIONS
 
 %left NotFootnote
 %left FOOTNOTE
@@ -184,7 +343,7 @@ static void nmc_node_unlink_and_free(struct nmc_node *node, struct parser *parse
 
 %type <node> documenttitle
 %type <nodes> words
-%type <nodes> oblockssections0 blockssections0 sections0
+%type <nodes> oblockssections0 blockssections0 sections0 topsection
 %type <nodes> blockssections blocks sections oblockssections
 %type <node> block footnotedsection section title
 %type <footnote> footnotes
@@ -227,16 +386,15 @@ static void nmc_node_unlink_and_free(struct nmc_node *node, struct parser *parse
                 YYFPRINTF(yyoutput, "%s (unrecognized)", $$->id.string);
 } <footnote>
 
-%destructor { nmc_node_unlink_and_free($$.first, parser); } <nodes>
-%destructor { nmc_node_unlink_and_free($$, parser); } <node>
-%destructor { footnote_free($$); } <footnote>
+/* NOTE All semantic values are allocated in parser->arena, so nothing needs
+ * to be destroyed when bison discards them. */
 
 %code
 {
 static inline bool
 parser_is_oom(struct parser *parser)
 {
-        return parser->errors.last == &nmc_parser_oom_error;
+        return parser->errors.last == parser->oom;
 }
 
 static void
@@ -244,7 +402,8 @@ parser_errors(struct parser *parser,
               struct nmc_parser_error *first, struct nmc_parser_error *last)
 {
         if (parser_is_oom(parser)) {
-                nmc_parser_error_free(first);
+                if (first != parser->oom)
+                        nmc_parser_error_free(first);
                 return;
         }
         if (parser->errors.first == NULL)
@@ -255,13 +414,96 @@ parser_errors(struct parser *parser,
                 parser->errors.last = last;
 }
 
+static bool
+lines_index(struct parser *parser)
+{
+        size_t n = 1;
+        for (const char *p = parser->input;
+             (p = memchr(p, '\n', parser->end - p)) != NULL; p++)
+                n++;
+        parser->lines.begins = malloc(n * sizeof(*parser->lines.begins));
+        if (parser->lines.begins == NULL)
+                return false;
+        parser->lines.begins[0] = parser->input;
+        n = 1;
+        for (const char *p = parser->input;
+             (p = memchr(p, '\n', parser->end - p)) != NULL; p++)
+                parser->lines.begins[n++] = p + 1;
+        parser->lines.n = n;
+        return true;
+}
+
+static int
+parser_line(struct parser *parser, const char *p, const char **begin)
+{
+        if (parser->lines.begins == NULL && !lines_index(parser)) {
+                // NOTE Without memory for the index, count lines the slow way.
+                int line = 1;
+                *begin = parser->input;
+                for (const char *q = parser->input;
+                     (q = memchr(q, '\n', p - q)) != NULL; q++) {
+                        line++;
+                        *begin = q + 1;
+                }
+                return line;
+        }
+        size_t low = 0, high = parser->lines.n;
+        while (high - low > 1) {
+                size_t middle = low + (high - low) / 2;
+                if (parser->lines.begins[middle] <= p)
+                        low = middle;
+                else
+                        high = middle;
+        }
+        *begin = parser->lines.begins[low];
+        return low + 1;
+}
+
+static PURE const char *
+parser_rebase(const struct parser *parser, const char *p)
+{
+        list_for_each(struct moved, m, parser->moved)
+                if (m->input <= p && p <= m->end)
+                        return parser->input + (p - m->input);
+        return p;
+}
+
+// NOTE The last column is that of the last cell of the last character, so
+// a wide character ends one column after it begins.  An empty span is
+// reported as the point that it begins at.
+static struct nmc_location
+parser_location(struct parser *parser, const YYLTYPE *location)
+{
+        YYLTYPE span = *location;
+        if (UNLIKELY(parser->moved != NULL) &&
+            !(parser->input <= span.begin && span.begin <= parser->end))
+                span = (YYLTYPE){
+                        parser_rebase(parser, span.begin),
+                        parser_rebase(parser, span.end)
+                };
+        struct nmc_location l;
+        const char *begin;
+        l.first_line = parser_line(parser, span.begin, &begin);
+        l.first_column = 1 + u_width(begin, span.begin - begin);
+        if (span.end <= span.begin) {
+                l.last_line = l.first_line;
+                l.last_column = l.first_column;
+        } else {
+                l.last_line = parser_line(parser, span.end - 1, &begin);
+                l.last_column = u_width(begin, span.end - begin);
+        }
+        return l;
+}
+
+#define point(p) ((YYLTYPE){ (p), (p) })
+
 static void
 parser_oom(struct parser *parser)
 {
         if (parser_is_oom(parser))
                 return;
-        nmc_parser_oom_error.location = parser->location;
-        parser_errors(parser, &nmc_parser_oom_error, &nmc_parser_oom_error);
+        parser->oom->location = parser_location(parser, &point(parser->p));
+        parser_errors(parser, parser->oom, parser->oom);
 }
 
 static bool NMC_PRINTF(3, 0)
@@ -270,7 +512,8 @@ parser_errorv(struct parser *parser, YYLTYPE *location,
 {
         if (parser_is_oom(parser))
                 return false;
-        struct nmc_parser_error *error = nmc_parser_error_newv(location, message, args);
+        struct nmc_location l = parser_location(parser, location);
+        struct nmc_parser_error *error = nmc_parser_error_newv(&l, message, args);
         if (error == NULL) {
                 parser_oom(parser);
                 return false;
@@ -290,34 +533,18 @@ parser_error(struct parser *parser, YYLTYPE *location,
         return r;
 }
 
-static void
-locate(struct parser *parser, YYLTYPE *location, const char *begin, size_t length)
-{
-        if (length > 0)
-                parser->location.last_column += u_width(begin, length) - 1;
-        *location = parser->location;
-}
-
+// NOTE A token begins at parser->first, which is where the previous one
+// ended, unless the lexer moved it, for example to the beginning of a line
+// to include its indent.
 static int
 token(struct parser *parser, YYLTYPE *location, const char *end, int type)
 {
         if (location != NULL)
-                locate(parser, location, parser->p, end - parser->p);
-        parser->location.first_line = parser->location.last_line;
-        parser->location.last_column++;
-        parser->location.first_column = parser->location.last_column;
-        parser->p = end;
+                *location = (YYLTYPE){ parser->first, end };
+        parser->first = parser->p = end;
         return type;
 }
 
-static int
-multitoken(struct parser *parser, YYLTYPE *location, const char *begin,
-           const char *end, int type)
-{
-        locate(parser, location, begin, end - begin);
-        return token(parser, NULL, end, type);
-}
-
 static int
 substring(struct parser *parser, YYLTYPE *location, YYSTYPE *value,
           const char *end, int type)
@@ -327,14 +554,66 @@ substring(struct parser *parser, YYLTYPE *location, YYSTYPE *value,
         return token(parser, location, end, type);
 }
 
+// NOTE The input isn’t NUL-terminated, so all reads go through at(),
+// decode(), dref(), and find(), which treat the end of the input as a
+// ‘\0’.  An embedded NUL byte thus ends whatever construct is being
+// scanned, and is then reported by bol() or parser_lex().  Each of them
+// notes when it reached the end, as a push parser that may yet be fed
+// more input has to lex the token again once it has been.
+static inline char
+at(struct parser *parser, const char *p)
+{
+        if (LIKELY(p < parser->end))
+                return *p;
+        parser->starved = true;
+        return '\0';
+}
+
+static uchar
+decode_multibyte(struct parser *parser, const char *p, size_t *length)
+{
+        uchar c = u_decode_multibyte(p, parser->end, length);
+        if (p >= parser->end ||
+            (c == U_BAD_INPUT_CHAR && p + *length == parser->end))
+                parser->starved = true;
+        return c;
+}
+
+static inline uchar
+decode(struct parser *parser, const char *p, size_t *length)
+{
+        if (LIKELY(p < parser->end && *(const unsigned char *)p < 0x80)) {
+                *length = 1;
+                return *(const unsigned char *)p;
+        }
+        return decode_multibyte(parser, p, length);
+}
+
+static inline uchar
+dref(struct parser *parser, const char *p)
+{
+        size_t length;
+        return decode(parser, p, &length);
+}
+
+static inline const char *
+find(struct parser *parser, const char *p, unsigned int which)
+{
+        const char *q = structure_find(&parser->structure, p, which);
+        if (q >= parser->end)
+                parser->starved = true;
+        return q;
+}
+
 typedef bool (*isfn)(uchar);
 
-static PURE inline size_t
-length_of_run(const char *p, isfn is)
+static inline size_t
+length_of_run(struct parser *parser, const char *p, isfn is)
 {
         const char *end = p;
-        while (is(u_dref(end)))
-                end = u_next(end);
+        size_t l;
+        while (is(decode(parser, end, &l)))
+                end += l;
         return end - p;
 }
 
@@ -359,10 +638,10 @@ is_superscript(uchar c)
         }
 }
 
-static PURE inline size_t
-superscript(const char *p)
+static inline size_t
+superscript(struct parser *parser, const char *p)
 {
-        return length_of_run(p, is_superscript);
+        return length_of_run(parser, p, is_superscript);
 }
 
 #define U_SUBSCRIPT_0 ((uchar)0x2080)
@@ -374,10 +653,10 @@ is_subscript(uchar c)
         return U_SUBSCRIPT_0 <= c && c <= U_SUBSCRIPT_9;
 }
 
-static PURE inline size_t
-subscript(const char *p)
+static inline size_t
+subscript(struct parser *parser, const char *p)
 {
-        return length_of_run(p, is_subscript);
+        return length_of_run(parser, p, is_subscript);
 }
 
 static inline bool
@@ -386,17 +665,18 @@ is_digit(uchar c)
         return '0' <= c && c <= '9';
 }
 
-static PURE inline size_t
-enumeration(const char *p)
+static inline size_t
+enumeration(struct parser *parser, const char *p)
 {
-        size_t length = length_of_run(p, is_digit);
+        size_t length = length_of_run(parser, p, is_digit);
         if (length == 0) {
-                if ('a' <= *p && *p <= 'z')
+                char c = at(parser, p);
+                if ('a' <= c && c <= 'z')
                         length = 1;
                 else
                         return 0;
         }
-        switch (*(p + length)) {
+        switch (at(parser, p + length)) {
         case ')':
         case '.':
                 return length + 1;
@@ -406,127 +686,129 @@ enumeration(const char *p)
 }
 
 static inline bool
-is_end(const char *end)
+is_end(struct parser *parser, const char *end)
+{
+        char c = at(parser, end);
+        return c == '\0' || c == '\n';
+}
+
+static inline bool
+is_space_or_end(struct parser *parser, const char *end)
+{
+        return is_end(parser, end) || at(parser, end) == ' ';
+}
+
+// NOTE Most runs of spaces are a single space long, or empty, so look at
+// the first byte before going to the index.
+static inline const char *
+skip_spaces(struct parser *parser, const char *p)
+{
+        if (at(parser, p) != ' ')
+                return p;
+        return find(parser, p + 1, STRUCTURE_NONSPACES);
+}
+
+static inline const char *
+end_of_line(struct parser *parser, const char *p)
+{
+        return find(parser, p, STRUCTURE_ENDS);
+}
+
+// NOTE Whether a push parser is lexing the token of type beginning at
+// parser->p again, and can resume where it was.
+static inline bool
+resuming(const struct parser *parser, int type)
+{
+        return parser->resume.p == parser->p && parser->resume.type == type;
+}
+
+// NOTE Whether all that the token being lexed has looked at so far was
+// input, so that it would look the same were there more.
+static inline bool
+can_resume(const struct parser *parser)
 {
-        return *end == '\0' || *end == '\n';
+        return parser->more && !parser->starved;
 }
 
+// NOTE Whether the token being lexed ran out of input before more may
+// follow, so that it’s thrown away, and what it only needs once it’s
+// complete can be skipped.
 static inline bool
-is_space_or_end(const char *end)
+incomplete(const struct parser *parser)
 {
-        return is_end(end) || *end == ' ';
+        return parser->more && parser->starved;
 }
 
 static char *
 text(struct parser *parser, YYLTYPE *location, const char *begin)
 {
-        while (*begin == ' ')
-                begin++;
-        const char *lbegin = parser->p;
-        const char *end = begin;
-        struct buffer b = BUFFER_INIT;
+        const char *end;
+        struct buffer *b = &parser->scratch;
+        if (resuming(parser, FOOTNOTE)) {
+                begin = parser->resume.begin;
+                end = parser->resume.end;
+                b->length = parser->resume.length;
+        } else {
+                begin = skip_spaces(parser, begin);
+                end = begin;
+                b->length = 0;
+        }
 
 again:
-        switch (*end) {
+        switch (at(parser, end)) {
         case '\0':
                 break;
         case '\n': {
                 const char *send = end + 1;
-                while (*send == ' ')
-                        send++;
-                if (!is_end(send) &&
+                send = skip_spaces(parser, send);
+                if (!is_end(parser, send) &&
                     (size_t)(send - (end + 1)) >= parser->indent + 2) {
-                        if (!buffer_append(&b, begin, end - begin))
+                        if (!buffer_append(b, begin, end - begin))
                                 goto oom;
-                        lbegin = end + 1;
                         begin = send - 1;
                         end = send;
-                        parser->location.last_line++;
+                        if (can_resume(parser))
+                                parser->resume = (struct resume){
+                                        .p = parser->p, .type = FOOTNOTE,
+                                        .begin = begin, .end = end,
+                                        .length = b->length
+                                };
                         goto again;
                 }
                 break;
         }
         case ' ':
                 end++;
-                if (!buffer_append(&b, begin, end - begin))
+                if (!buffer_append(b, begin, end - begin))
                         goto oom;
-                while (*end == ' ')
-                        end++;
+                end = skip_spaces(parser, end);
                 begin = end;
                 goto again;
         default:
-                end++;
+                end = find(parser, end + 1, STRUCTURE_ENDS | STRUCTURE_SPACES);
                 goto again;
         }
-        if (!buffer_append(&b, begin, end - begin))
+        if (!buffer_append(b, begin, end - begin))
                 goto oom;
 
         // NOTE We use a throwaway type here; caller must return actual type.
-        multitoken(parser, location, lbegin, end, ERROR);
-        return buffer_str(&b);
+        token(parser, location, end, ERROR);
+        return buffer_cstr(b);
 oom:
-        multitoken(parser, location, lbegin, end, ERROR);
-        free(b.content);
+        token(parser, location, end, ERROR);
         return NULL;
 }
 
 static size_t
 bol_space(struct parser *parser, size_t offset)
 {
-        if (*(parser->p + offset) == ' ')
+        if (at(parser, parser->p + offset) == ' ')
                 return offset + 1;
-        YYLTYPE location = parser->location;
-        location.first_column += offset;
-        location.last_column = location.first_column;
-        parser_error(parser, &location,
+        parser_error(parser, &point(parser->p + offset),
                      "expected ‘ ’ after “%.*s”", (int)offset, parser->p);
         return offset;
 }
 
-typedef struct nmc_data_node *(*definefn)(const char *, regmatch_t *);
-
-struct definition {
-        struct definition *next;
-        regex_t regex;
-        definefn define;
-};
-
-static struct definition *definitions;
-
-static char *
-aregerror(int errcode, const regex_t *regex)
-{
-        size_t n = regerror(errcode, regex, NULL, 0);
-        char *s = malloc(n);
-        if (s == NULL)
-                return NULL;
-        regerror(errcode, regex, s, n);
-        return s;
-}
-
-static bool
-definitions_push(const char *pattern, definefn define, struct nmc_error *error)
-{
-        struct definition *definition = malloc(sizeof(struct definition));
-        if (definition == NULL)
-                return nmc_error_oom(error);
-        int r = regcomp(&definition->regex, pattern, REG_EXTENDED);
-        if (r != 0) {
-                char *s = aregerror(r, &definition->regex);
-                free(definition);
-                if (s == NULL)
-                        return nmc_error_oom(error);
-                nmc_error_format(error, -1,
-                                 "definition regex compilation failed: %s", s);
-                free(s);
-                return false;
-        }
-        definition->define = define;
-        definition->next = definitions;
-        definitions = definition;
-        return true;
-}
-
 static inline struct nmc_node *
 node_init(struct nmc_node *node, enum nmc_node_type type, enum nmc_node_name name)
 {
@@ -537,290 +819,298 @@ node_init(struct nmc_node *node, enum nmc_node_type type, enum nmc_node_name nam
         node->name = name;
         return node;
 }
-#define node_new(stype, type, name) ((stype *)node_init(malloc(sizeof(stype)), type, name))
+#define node_new(parser, stype, type, name) \
+        ((stype *)node_init(nmc_arena_alloc((parser)->arena, sizeof(stype)), \
+                            type, name))
 
 static struct nmc_data_node *
-data_node_new(enum nmc_node_name name, size_t n)
+data_node_new(struct parser *parser, enum nmc_node_name name, size_t n)
 {
-        struct nmc_data_node *d = node_new(struct nmc_data_node,
+        struct nmc_data_node *d = node_new(parser, struct nmc_data_node,
                                            NMC_NODE_TYPE_DATA, name);
         if (d == NULL)
                 return NULL;
         d->node.children = NULL;
-        d->data = malloc(sizeof(struct nmc_node_data) +
-                         sizeof(struct nmc_node_datum) * (n + 1));
-        if (d->data == NULL) {
-                free(d);
+        d->data = nmc_arena_alloc(parser->arena,
+                                  sizeof(struct nmc_node_datum) * (n + 1));
+        if (d->data == NULL)
                 return NULL;
-        }
-        d->data->references = 1;
-        d->data->data[n].name = NULL;
-        d->data->data[n].value = NULL;
+        d->data[n].name = NULL;
+        d->data[n].value = NULL;
         return d;
 }
 
-static void
-node_data_free(struct nmc_node_data *data)
-{
-        if (--data->references > 0)
-                return;
-        for (struct nmc_node_datum *d = data->data; d->value != NULL; d++)
-                free(d->value);
-        free(data);
-}
-
 static struct nmc_data_node *
 data_node_set(struct nmc_data_node *node, size_t index,
               const char *name, char *value)
 {
-        node->data->data[index].name = name;
-        node->data->data[index].value = value;
-        if (node->data->data[index].value == NULL) {
-                nmc_node_free((struct nmc_node *)node);
+        node->data[index].name = name;
+        node->data[index].value = value;
+        if (node->data[index].value == NULL)
                 return NULL;
-        }
         return node;
 }
 
 static struct nmc_data_node *
-data_node_set_match(struct nmc_data_node *node, size_t index,
-                    const char *name, const char *buffer, regmatch_t *match)
+data_node_set_capture(struct parser *parser, struct nmc_data_node *node,
+                      size_t index, const char *name,
+                      struct footnote_capture *capture)
 {
-        assert(match->rm_so != -1);
-        assert(match->rm_eo != -1);
+        assert(capture->string != NULL);
         if (data_node_set(node, index, name,
-                          mstrdup(buffer + match->rm_so,
-                                  match->rm_eo - match->rm_so)) == NULL)
+                          nmc_arena_strndup(parser->arena, capture->string,
+                                            capture->length)) == NULL)
                 return NULL;
         return node;
 }
 
-struct data_mapping {
-        const char *name;
-        int index;
-};
-
 static struct nmc_data_node *
-data_node_add_matches(struct nmc_data_node *node,
-                      const char *buffer, regmatch_t *matches,
-                      struct data_mapping *mappings)
+abbreviation(struct parser *parser, struct footnote_capture *captures)
 {
-        if (node == NULL)
+        struct nmc_data_node *d = data_node_new(parser, NMC_NODE_ABBREVIATION, 1);
+        if (d == NULL)
                 return NULL;
-        size_t d = 0;
-        for (struct data_mapping *p = mappings; p->name != NULL; p++) {
-                int i = p->index;
-                if (i < 0) {
-                        i = -i;
-                        if (matches[i].rm_so == -1 || matches[i].rm_eo == -1)
-                                continue;
-                }
-                if (data_node_set_match(node, d, p->name, buffer, &matches[i]) == NULL)
-                        return NULL;
-                d++;
-        }
-        return node;
+        return data_node_set_capture(parser, d, 0, "for", &captures[0]);
 }
 
 static struct nmc_data_node *
-data_node_new_matches(enum nmc_node_name name, size_t n,
-                      const char *buffer, regmatch_t *matches,
-                      struct data_mapping *mappings)
+data_node_new_link(struct parser *parser, size_t n,
+                   struct footnote_capture *title, struct footnote_capture *uri)
 {
-        return data_node_add_matches(data_node_new(name, n), buffer, matches,
-                                     mappings);
-}
-
-static struct nmc_data_node *
-abbreviation(const char *buffer, regmatch_t *matches)
-{
-        return data_node_new_matches(NMC_NODE_ABBREVIATION, 1, buffer, matches,
-                                     (struct data_mapping[]){
-                                             { "for", 1 },
-                                             { NULL, 0 }
-                                     });
-}
-
-static struct nmc_data_node *
-data_node_new_link(size_t n, const char *buffer, regmatch_t *matches,
-                   int *indexes)
-{
-        return data_node_new_matches(NMC_NODE_LINK, n, buffer, matches,
-                                     (struct data_mapping []){
-                                             { "title", indexes[0] },
-                                             { "uri", indexes[1] },
-                                             { NULL, 0 }
-                                     });
+        bool titled = title->string != NULL;
+        struct nmc_data_node *d = data_node_new(parser, NMC_NODE_LINK,
+                                                n + (titled ? 1 : 0));
+        if (d == NULL ||
+            (titled && data_node_set_capture(parser, d, 0, "title", title) == NULL) ||
+            data_node_set_capture(parser, d, titled ? 1 : 0, "uri", uri) == NULL)
+                return NULL;
+        return d;
 }
 
 static struct nmc_data_node *
-inline_figure(const char *buffer, regmatch_t *matches)
+inline_figure(struct parser *parser, struct footnote_capture *captures)
 {
-        bool alternate = matches[4].rm_so != -1;
+        bool alternate = captures[2].string != NULL;
         struct nmc_data_node *d =
-                data_node_new_link(3 + (alternate ? 1 : 0), buffer, matches,
-                                   (int[]){ 1, 2 });
+                data_node_new_link(parser, 2 + (alternate ? 1 : 0),
+                                   &captures[0], &captures[1]);
         if (d == NULL ||
-            data_node_set(d, 2, "relation", mstrdup("figure", 6)) == NULL ||
+            data_node_set(d, 2, "relation", (char *)"figure") == NULL ||
             (alternate &&
-             data_node_set_match(d, 3, "relation-data", buffer, &matches[4]) == NULL))
+             data_node_set_capture(parser, d, 3, "relation-data",
+                                   &captures[2]) == NULL))
                 return NULL;
         return d;
 }
 
 static struct nmc_data_node *
-link(const char *buffer, regmatch_t *matches)
-{
-        return data_node_new_link(1 + (matches[6].rm_so != -1 ||
-                                       matches[4].rm_so != -1 ? 1 : 0), buffer, matches,
-                                  (int[]){ matches[6].rm_so != -1 ? 6 : -4, 8 });
-}
-
-static bool
-definitions_init(struct nmc_error *error)
-{
-        if (definitions != NULL)
-                return true;
-        return  definitions_push("^(See +((the +)?(.+)(:| +at) +)?|(.+)(:| +at) +)([^ ]+)", link, error) &&
-                definitions_push("^(.+), +see +([^ ]+)( +\\((.+)\\))?", inline_figure, error) &&
-                definitions_push("^Abbreviation +for +(.+)", abbreviation, error);
-}
-
-static void
-definitions_free(void)
+link(struct parser *parser, struct footnote_capture *captures)
 {
-        list_for_each_safe(struct definition, p, n, definitions) {
-                regfree(&p->regex);
-                free(p);
-        }
-        definitions = NULL;
+        return data_node_new_link(parser, 1, &captures[0], &captures[1]);
 }
 
 static struct nmc_data_node *
-define(YYLTYPE *location, const char *content, struct nmc_parser_error **error)
-{
-        list_for_each(struct definition, p, definitions) {
-                regmatch_t matches[p->regex.re_nsub + 1];
-                int r = regexec(&p->regex, content,
-                                p->regex.re_nsub + 1, matches, 0);
-                if (r == 0)
-                        return p->define(content, matches);
-                else if (r != REG_NOMATCH) {
-                        char *s = aregerror(r, &p->regex);
-                        if (s == NULL) {
-                                *error = &nmc_parser_oom_error;
-                                return NULL;
-                        }
-                        *error = nmc_parser_error_new(location,
-                                                      "footnote definition regex execution failed: %s",
-                                                      s);
-                        free(s);
-                        if (*error == NULL)
-                                *error = &nmc_parser_oom_error;
-                        return NULL;
-                }
-        }
-        *error = nmc_parser_error_new(location, "unrecognized footnote content: %s", content);
+define(struct parser *parser, YYLTYPE *location, const char *content,
+       struct nmc_parser_error **error)
+{
+        size_t n = strlen(content);
+        struct footnote_capture captures[3];
+        if (footnote_abbreviation(content, n, captures))
+                return abbreviation(parser, captures);
+        else if (footnote_inline_figure(content, n, captures))
+                return inline_figure(parser, captures);
+        else if (footnote_link(content, n, captures))
+                return link(parser, captures);
+        struct nmc_location l = parser_location(parser, location);
+        *error = nmc_parser_error_new(&l, "unrecognized footnote content: %s", content);
         return NULL;
 }
 
 static int
 footnote(struct parser *parser, YYLTYPE *location, YYSTYPE *value, size_t length)
 {
-        value->footnote = malloc(sizeof(struct footnote));
+        value->footnote = nmc_arena_alloc(parser->arena, sizeof(struct footnote));
         if (value->footnote == NULL)
                 return FOOTNOTE;
         value->footnote->next = NULL;
-        char *id = mstrdup(parser->p, length);
+        char *id = nmc_arena_strndup(parser->arena, parser->p, length);
         if (id == NULL)
                 goto oom;
         value->footnote->id = id_new(id);
         char *content = text(parser, location, parser->p + bol_space(parser, length));
         if (content == NULL)
-                goto oom_id;
+                goto oom;
+        // NOTE Matching the text takes time linear in its length.
+        if (incomplete(parser))
+                return FOOTNOTE;
         struct nmc_parser_error *error = NULL;
-        value->footnote->node = define(location, content, &error);
-        free(content);
+        value->footnote->node = define(parser, location, content, &error);
         if (value->footnote->node == NULL) {
                 if (error == NULL)
-                        goto oom_id;
+                        goto oom;
                 parser_errors(parser, error, error);
         }
         value->footnote->location = *location;
         return FOOTNOTE;
-oom_id:
-        free(id);
 oom:
-        free(value->footnote);
         value->footnote = NULL;
         return FOOTNOTE;
 }
 
+static inline bool
+parser_references_input(struct parser *parser)
+{
+        return parser->flags & NMC_PARSE_REFERENCE_INPUT;
+}
+
 static struct nmc_node *
-text_node_new(enum nmc_node_name name, char *text)
+text_node_new(struct parser *parser, enum nmc_node_name name,
+              const char *string, size_t length)
 {
-        if (text == NULL)
+        if (string == NULL)
                 return NULL;
-        struct nmc_text_node *n = node_new(struct nmc_text_node,
+        struct nmc_text_node *n = node_new(parser, struct nmc_text_node,
                                            NMC_NODE_TYPE_TEXT, name);
-        if (n == NULL) {
-                free(text);
+        if (n == NULL)
                 return NULL;
-        }
-        n->text = text;
+        n->text.next = NULL;
+        n->text.string = string;
+        n->text.length = length;
         return (struct nmc_node *)n;
 }
 
+static struct nmc_node *
+text_node_new_dup(struct parser *parser, enum nmc_node_name name,
+                  const char *string, size_t length)
+{
+        return text_node_new(parser, name,
+                             nmc_arena_strndup(parser->arena, string, length),
+                             length);
+}
+
+static struct nmc_node *
+text_node_new_substring(struct parser *parser, enum nmc_node_name name,
+                        const char *string, size_t length)
+{
+        if (parser_references_input(parser))
+                return text_node_new(parser, name, string, length);
+        return text_node_new_dup(parser, name, string, length);
+}
+
+static struct nmc_text *
+text_append(struct parser *parser, struct nmc_text *last, const char *string,
+            size_t length)
+{
+        if (last->string + last->length == string) {
+                last->length += length;
+                return last;
+        }
+        struct nmc_text *t = nmc_arena_alloc(parser->arena, sizeof(struct nmc_text));
+        if (t == NULL)
+                return NULL;
+        t->next = NULL;
+        t->string = string;
+        t->length = length;
+        last->next = t;
+        return t;
+}
+
+static bool
+text_copy(struct parser *parser, struct nmc_text *text)
+{
+        size_t length = 0;
+        list_for_each(struct nmc_text, p, text)
+                length += p->length;
+        char *s = nmc_arena_alloc(parser->arena, length);
+        if (s == NULL)
+                return false;
+        char *q = s;
+        list_for_each(struct nmc_text, p, text) {
+                memcpy(q, p->string, p->length);
+                q += p->length;
+        }
+        text->next = NULL;
+        text->string = s;
+        text->length = length;
+        return true;
+}
+
+static const char newlines[] = "\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n";
+
 static int
 codeblock(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 {
-        const char *lbegin = parser->p;
         const char *begin = parser->p + 4;
         const char *end = begin;
-        struct buffer b = BUFFER_INIT;
-
-        while (*end != '\0') {
-                while (!is_end(end))
-                        end++;
-                if (!buffer_append(&b, begin, end - begin))
+        struct nmc_text_node *n;
+        struct nmc_text *last;
+        if (resuming(parser, CODEBLOCK)) {
+                begin = parser->resume.begin;
+                end = parser->resume.end;
+                n = parser->resume.node;
+                last = parser->resume.last;
+        } else {
+                n = (struct nmc_text_node *)
+                        text_node_new(parser, NMC_NODE_CODEBLOCK, begin, 0);
+                if (n == NULL)
                         goto oom;
-                if (*end != '\n')
+                last = &n->text;
+        }
+
+        while (at(parser, end) != '\0') {
+                end = end_of_line(parser, end);
+                if (at(parser, end) != '\n') {
+                        if ((last = text_append(parser, last, begin, end - begin)) == NULL)
+                                goto oom;
                         break;
+                }
                 size_t lines = 1;
                 const char *sbegin = end + 1;
                 const char *send = sbegin;
                 while (true) {
-                        while (*send == ' ')
-                                send++;
-                        if (*send != '\n')
+                        send = skip_spaces(parser, send);
+                        if (at(parser, send) != '\n')
                                 break;
                         lines++;
                         sbegin = send + 1;
                         send = sbegin;
                 }
-                if ((size_t)(send - sbegin) < parser->indent + 4)
+                if ((size_t)(send - sbegin) < parser->indent + 4) {
+                        if ((last = text_append(parser, last, begin, end - begin)) == NULL)
+                                goto oom;
                         break;
-                lbegin = sbegin;
+                }
+                // NOTE The first newline is taken from the input and any
+                // following ones, as the lines they end may contain spaces,
+                // from newlines.
+                if ((last = text_append(parser, last, begin, end + 1 - begin)) == NULL)
+                        goto oom;
+                for (size_t i = lines - 1; i > 0; ) {
+                        size_t m = i < lengthof(newlines) - 1 ? i : lengthof(newlines) - 1;
+                        if ((last = text_append(parser, last, newlines, m)) == NULL)
+                                goto oom;
+                        i -= m;
+                }
                 begin = sbegin + parser->indent + 4;
                 end = send;
-                parser->location.last_column = 1;
-                parser->location.last_line += lines;
-                if (!buffer_append_c(&b, '\n', lines))
-                        goto oom;
+                if (can_resume(parser))
+                        parser->resume = (struct resume){
+                                parser->p, CODEBLOCK, begin, end, n, last, 0,
+                                nmc_arena_mark(parser->arena)
+                        };
         }
 
-        value->node = text_node_new(NMC_NODE_CODEBLOCK, buffer_str(&b));
+        // NOTE A code block that is lexed again resumes with its text as it
+        // is, so it’s only copied once it’s complete.
+        if (!parser_references_input(parser) && !incomplete(parser) &&
+            !text_copy(parser, &n->text))
+                goto oom;
+        value->node = (struct nmc_node *)n;
         goto done;
 oom:
         value->node = NULL;
 done:
-        return multitoken(parser, location, lbegin, end, CODEBLOCK);
-}
-
-static struct nmc_node *
-text_node_new_dup(enum nmc_node_name name, const char *string, size_t length)
-{
-        return text_node_new(name, mstrdup(string, length));
+        return token(parser, location, end, CODEBLOCK);
 }
 
 static int NMC_PRINTF(5, 6)
@@ -830,30 +1120,33 @@ error_token(struct parser *parser, YYLTYPE *location, const char *end, int type,
         va_list args;
         va_start(args, message);
         int r = token(parser, location, end, type);
-        YYLTYPE l = parser->location;
-        if (location == NULL) {
-                l.first_column--;
-                l.last_column--;
-        }
-        parser_errorv(parser, &l, message, args);
+        parser_errorv(parser, &point(end), message, args);
         va_end(args);
         return r;
 }
 
 static int
-term(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
+nul(struct parser *parser)
 {
-        const char *begin = parser->p + bol_space(parser, 1);
-        const char *end = begin;
+        parser_error(parser, &point(parser->p), "unexpected NUL byte");
+        return token(parser, NULL, parser->p + 1, AGAIN);
+}
+
+static int
+term(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
+{
+        const char *begin = parser->p + bol_space(parser, 1);
+        const char *end = begin;
 
-        while (!is_end(end)) {
+        while (!is_end(parser, end)) {
                 if (*end == '.') {
                         const char *send = end;
                         end++;
-                        while (*end == ' ')
-                                end++;
-                        if (*end == '=' && is_space_or_end(end + 1)) {
-                                value->node = text_node_new_dup(NMC_NODE_TERM, begin, send - begin);
+                        end = skip_spaces(parser, end);
+                        if (at(parser, end) == '=' &&
+                            is_space_or_end(parser, end + 1)) {
+                                value->node = text_node_new_substring(parser, NMC_NODE_TERM,
+                                                                      begin, send - begin);
                                 return token(parser, location, end + 1, TERM);
                         }
                 } else
@@ -868,12 +1161,10 @@ static const char *
 skip_spaces_and_empty_lines(struct parser *parser, const char **begin, const char *end)
 {
         while (true) {
-                while (*end == ' ')
-                        end++;
-                if (*end != '\n')
+                end = skip_spaces(parser, end);
+                if (at(parser, end) != '\n')
                         break;
                 end++;
-                parser->location.last_line++;
                 *begin = end;
         }
         return end;
@@ -883,14 +1174,12 @@ static const char *
 figure_alternate(struct parser *parser, const char **begin, const char **end)
 {
         const char *p = *end;
-        if (*p != '\n')
+        if (at(parser, p) != '\n')
                 return NULL;
         p++;
-        parser->location.last_line++;
         *begin = p;
-        while (*p == ' ')
-                p++;
-        if (*p != '(') {
+        p = skip_spaces(parser, p);
+        if (at(parser, p) != '(') {
                 *end = p;
                 return NULL;
         }
@@ -898,7 +1187,7 @@ figure_alternate(struct parser *parser, const char **begin, const char **end)
         size_t nesting = 1;
         const char *middle = p;
         while (true) {
-                switch (*p) {
+                switch (at(parser, p)) {
                 case '(':
                         nesting++;
                         break;
@@ -924,70 +1213,54 @@ figure(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 
         const char *begin = parser->p;
         const char *end = parser->p + 4;
-        switch (*end) {
+        switch (at(parser, end)) {
         case '\n':
-                parser->location.last_line++;
                 begin = end + 1;
                 // Fall through
         case ' ':
                 end++;
                 break;
         default:
-                if (!parser_error(parser, &parser->location,
+                if (!parser_error(parser, &point(end),
                                   "expected ‘ ’ or newline after figure tag (“Fig.”)"))
                         goto oom;
         }
 
         end = skip_spaces_and_empty_lines(parser, &begin, end);
-        if (*end == '\0') {
-                locate(parser, location, begin, end - begin);
-                return error_token(parser, NULL, end, END,
+        if (at(parser, end) == '\0')
+                return error_token(parser, location, end, END,
                                    "expected URI for figure image");
-        }
         const char *middle = end;
-        while (!is_end(end) && *end != ' ')
-                end++;
-        char *uri = mstrdup(middle, end - middle);
+        end = find(parser, end, STRUCTURE_ENDS | STRUCTURE_SPACES);
+        char *uri = nmc_arena_strndup(parser->arena, middle, end - middle);
         if (uri == NULL)
                 goto oom;
-        while (*end == ' ')
-                end++;
+        end = skip_spaces(parser, end);
         struct nmc_node *alternate = NULL;
         middle = figure_alternate(parser, &begin, &end);
         if (middle != NULL) {
-                bool terminated = *end == ')';
-                if (!terminated) {
-                        YYLTYPE l;
-                        locate(parser, &l, begin, end + 1 - begin);
-                        l.first_line = l.last_line;
-                        l.first_column = l.last_column;
-                        if (!parser_error(parser, &l,
-                                          "expected ‘)’ after figure image alternate text")) {
-                                free(uri);
-                                goto oom;
-                        }
-                }
-                alternate = text_node_new_dup(NMC_NODE_TEXT, middle, end - middle);
-                if (alternate == NULL) {
-                        free(uri);
+                bool terminated = at(parser, end) == ')';
+                if (!terminated &&
+                    !parser_error(parser, &point(end),
+                                  "expected ‘)’ after figure image alternate text"))
+                        goto oom;
+                alternate = text_node_new_substring(parser, NMC_NODE_TEXT,
+                                                    middle, end - middle);
+                if (alternate == NULL)
                         goto oom;
-                }
                 if (terminated)
                         end++;
         }
-        struct nmc_data_node *n = data_node_new(NMC_NODE_IMAGE, 1);
-        if (n == NULL) {
-                free(uri);
-                nmc_node_free(alternate);
+        struct nmc_data_node *n = data_node_new(parser, NMC_NODE_IMAGE, 1);
+        if (n == NULL)
                 goto oom;
-        }
-        n->data->data[0].name = "uri";
-        n->data->data[0].value = uri;
+        n->data[0].name = "uri";
+        n->data[0].value = uri;
         value->node = (struct nmc_node *)n;
         n->node.children = alternate;
 oom:
         end = skip_spaces_and_empty_lines(parser, &begin, end);
-        return multitoken(parser, location, begin, end, FIGURE);
+        return token(parser, location, end, FIGURE);
 }
 
 static char *token_name(int type);
@@ -998,7 +1271,7 @@ static int
 bol_token(struct parser *parser, YYLTYPE *location, size_t length, int type)
 {
         const char *end = parser->p + length;
-        if (*end != ' ') {
+        if (at(parser, end) != ' ') {
                 char *name = token_name(type);
                 if (name != NULL) {
                         int r = error_token(parser, location, end, type,
@@ -1017,9 +1290,9 @@ bol_token(struct parser *parser, YYLTYPE *location, size_t length, int type)
 #define U_EM_DASH ((uchar)0x2014)
 
 static bool
-is_bol_symbol(const char *end)
+is_bol_symbol(struct parser *parser, const char *end)
 {
-        uchar c = u_dref(end);
+        uchar c = dref(parser, end);
         switch (c) {
         case U_PILCROW_SIGN:
         case U_SECTION_SIGN:
@@ -1030,11 +1303,13 @@ is_bol_symbol(const char *end)
         case '|':
                 return true;
         case 'F':
-                return end[1] == 'i' && end[2] == 'g' && end[3] == '.';
+                return at(parser, end + 1) == 'i' &&
+                        at(parser, end + 2) == 'g' &&
+                        at(parser, end + 3) == '.';
         default:
                 return is_subscript(c) ||
                         is_superscript(c) ||
-                        enumeration(end) > 0;
+                        enumeration(parser, end) > 0;
         }
 }
 
@@ -1043,7 +1318,8 @@ bol_item(struct parser *parser, YYLTYPE *location, size_t length, int type)
 {
         const char *begin = parser->p + length;
         const char *end = begin;
-        if (*end != ' ' || *++end != ' ' || *++end != ' ') {
+        if (at(parser, end) != ' ' || at(parser, ++end) != ' ' ||
+            at(parser, ++end) != ' ') {
                 char *name = token_name(type);
                 int r = error_token(parser, location, end, type,
                                     "expected “%*s” after %s",
@@ -1060,17 +1336,22 @@ bol(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
         parser->bol = false;
 
         size_t length;
-        if ((length = subscript(parser->p)) > 0 ||
-            (length = enumeration(parser->p)) > 0)
+        if ((length = subscript(parser, parser->p)) > 0 ||
+            (length = enumeration(parser, parser->p)) > 0)
                 return bol_item(parser, location, length, ENUMERATION);
-        else if ((length = superscript(parser->p)) > 0)
+        else if ((length = superscript(parser, parser->p)) > 0)
                 return footnote(parser, location, value, length);
 
-        uchar c = u_lref(parser->p, &length);
+        uchar c = decode(parser, parser->p, &length);
+        if (c == '\0' && parser->p < parser->end) {
+                parser->bol = true;
+                return nul(parser);
+        }
         switch (c) {
         case ' ':
-                if (*(parser->p + 1) == ' ') {
-                        if (*(parser->p + 2) == ' ' && *(parser->p + 3) == ' ')
+                if (at(parser, parser->p + 1) == ' ') {
+                        if (at(parser, parser->p + 2) == ' ' &&
+                            at(parser, parser->p + 3) == ' ')
                                 return codeblock(parser, location, value);
                         return token(parser, location, parser->p + 2, PARAGRAPH);
                 }
@@ -1088,34 +1369,34 @@ bol(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
         case '>':
                 return bol_token(parser, location, length, QUOTE);
         case '|':
-                if (*(parser->p + 1) == '-') {
+                if (at(parser, parser->p + 1) == '-') {
                         const char *end = parser->p + 2;
-                        while (!is_end(end))
-                                end++;
+                        end = end_of_line(parser, end);
                         return token(parser, location, end, TABLESEPARATOR);
                 }
                 return bol_token(parser, location, length, ROW);
         case 'F':
-                if (parser->p[1] == 'i' && parser->p[2] == 'g' &&
-                    parser->p[3] == '.')
+                if (at(parser, parser->p + 1) == 'i' &&
+                    at(parser, parser->p + 2) == 'g' &&
+                    at(parser, parser->p + 3) == '.')
                         return figure(parser, location, value);
         case '\0':
                 return token(parser, location, parser->p, END);
         }
 
         if (c == U_BAD_INPUT_CHAR)
-                parser_error(parser, &parser->location,
+                parser_error(parser, &point(parser->p),
                              "broken UTF-8 sequence starting with %#02x",
                              *parser->p);
         else if (!uc_issolid(c))
-                parser_error(parser, &parser->location,
+                parser_error(parser, &point(parser->p),
                              "unrecognized tag character U+%04X",
                              c);
         else
-                parser_error(parser, &parser->location,
+                parser_error(parser, &point(parser->p),
                              "unrecognized tag character ‘%.*s’ (U+%04X)",
                              (int)length, parser->p, c);
-        locate(parser, location, parser->p, 0);
+        *location = (YYLTYPE){ parser->first, parser->p };
         return PARAGRAPH;
 }
 
@@ -1124,66 +1405,60 @@ indent(struct parser *parser, YYLTYPE *location, const char *begin, int type)
 {
         parser->bol = true;
         parser->indent += 2;
-        return multitoken(parser, location, begin, begin + parser->indent, type);
+        return token(parser, location, begin + parser->indent, type);
 }
 
 static int
-dedent(struct parser *parser, YYLTYPE *location, const char *begin, const char *end)
+dedent(struct parser *parser, YYLTYPE *location, const char *end)
 {
         parser->dedents--;
-        int r = multitoken(parser, location, begin, end, DEDENT);
-        if (parser->dedents > 0)
-                parser->location.last_column--;
-        return r;
+        return token(parser, location, end, DEDENT);
 }
 
 static int
 dedents(struct parser *parser, YYLTYPE *location, const char *begin, size_t spaces)
 {
-        parser->location.first_line = parser->location.last_line;
+        parser->first = begin;
         parser->dedents = (parser->indent - spaces) / 2;
         parser->indent -= 2 * parser->dedents;
-        return dedent(parser, location, begin, begin + parser->indent);
+        return dedent(parser, location, begin + parser->indent);
 }
 
 static int
 eol(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 {
-        parser->location.last_line++;
-        int first_line = parser->location.first_line;
-        parser->location.first_line = parser->location.last_line;
-        int first_column = parser->location.first_column;
-        parser->location.first_column = 1;
-        parser->location.last_column = 1;
-
+        const char *first = parser->first;
         const char *begin = parser->p + 1;
+        parser->first = begin;
         const char *end = begin;
-        while (*end == ' ')
-                end++;
-        if (*end == '\n') {
+        end = skip_spaces(parser, end);
+        if (at(parser, end) == '\n') {
                 parser->bol = true;
                 int want = parser->want;
                 parser->want = ERROR;
                 end++;
-                parser->location.last_line++;
                 begin = end;
                 end = skip_spaces_and_empty_lines(parser, &begin, end);
                 size_t spaces = end - begin;
                 if ((want == INDENT && spaces >= parser->indent + 2) ||
                     (want == ITEMINDENT && spaces >= parser->indent + 2 &&
-                     (spaces > parser->indent + 2 || is_bol_symbol(end)))) {
+                     (spaces > parser->indent + 2 || is_bol_symbol(parser, end)))) {
                         return indent(parser, location, begin, want);
                 } else if (spaces < parser->indent && spaces % 2 == 0) {
                         return dedents(parser, location, begin, spaces);
                 } else if (parser->indent > 0 && spaces == parser->indent &&
-                           !is_bol_symbol(end)) {
+                           !is_bol_symbol(parser, end)) {
                         // EXAMPLE An itemization containing multiple
                         // paragraphs followed by a paragraph.
                         return dedents(parser, location, begin, spaces - 2);
                 } else {
-                        parser->location.first_line = parser->location.last_line;
-                        locate(parser, location, begin, parser->indent);
-                        parser->p = begin + parser->indent;
+                        // NOTE An odd number of spaces on the last line
+                        // doesn’t reach the current indent.
+                        size_t indent = parser->indent;
+                        if (indent > (size_t)(parser->end - begin))
+                                indent = parser->end - begin;
+                        parser->first = begin;
+                        parser->p = begin + indent;
                         return bol(parser, location, value);
                 }
         } else {
@@ -1193,9 +1468,7 @@ eol(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
                         return indent(parser, location, begin, ITEMINDENT);
                 } else if (spaces > parser->indent) {
                 space:
-                        parser->location.first_line = first_line;
-                        parser->location.first_column = first_column;
-                        parser->location.last_column--;
+                        parser->first = first;
                         return substring(parser, location, value, end, SPACE);
                 } else if (spaces < parser->indent) {
                         if (spaces % 2 != 0)
@@ -1214,9 +1487,9 @@ eol(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 #define U_SUPERSCRIPT_PLUS_SIGN ((uchar)0x207a)
 
 static inline bool
-is_inline_symbol(const char *end)
+is_inline_symbol(uchar c)
 {
-        switch (u_dref(end)) {
+        switch (c) {
         case '|':
         case '/':
         case '{':
@@ -1230,41 +1503,109 @@ is_inline_symbol(const char *end)
         }
 }
 
-static inline int
-word(struct parser *parser, YYLTYPE *location, YYSTYPE *value, const char *end)
-{
-        while (true) {
-                if (is_space_or_end(end))
-                        break;
-                size_t l;
-                uchar c = u_lref(end, &l);
+// NOTE The character at end is decoded once and carried over to the next
+// iteration, so that each character of a word is only decoded once.  A
+// run of ASCII characters that aren’t specials can’t end the word before
+// its last character, as only specials can, so it’s skipped up to there.
+static const char *
+word_end(struct parser *parser, const char *end)
+{
+        size_t l;
+        uchar c = decode(parser, end, &l);
+        while (!is_space_or_end(parser, end)) {
+                if (c < 0x80) {
+                        const char *special = find(parser, end, STRUCTURE_SPECIALS);
+                        if (special - end > 1) {
+                                end = special - 1;
+                                c = *(const unsigned char *)end;
+                        }
+                }
                 if ((c == '}' ||
-                     (is_superscript(c) && (l += superscript(end + l), true))) &&
-                    !uc_isaletterornumeric(u_dref(end + l)))
+                     (is_superscript(c) &&
+                      (l += superscript(parser, end + l), true))) &&
+                    !uc_isaletterornumeric(dref(parser, end + l)))
                         break;
                 end += l;
-                if (!uc_isaletterornumeric(c) && !(c == ':' || c == '/')) {
-                        while (uc_isformatorextend(u_lref(end, &l)))
+                bool plain = uc_isaletterornumeric(c) || c == ':' || c == '/';
+                c = decode(parser, end, &l);
+                if (!plain) {
+                        while (uc_isformatorextend(c)) {
                                 end += l;
-                        if (is_inline_symbol(end))
+                                c = decode(parser, end, &l);
+                        }
+                        if (is_inline_symbol(c))
                                 break;
                 }
         }
+        return end;
+}
+
+static int
+word(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
+{
+        const char *end = word_end(parser, parser->p);
         if (end == parser->p)
                 return token(parser, location, parser->p, END);
         return substring(parser, location, value, end, WORD);
 }
 
+// NOTE Whether parser_lex() lexes a word beginning with c.  This must agree
+// with it.
+static inline bool
+is_word_start(uchar c)
+{
+        switch (c) {
+        case '\0':
+        case ' ':
+        case '\n':
+        case '}':
+        case U_SUPERSCRIPT_PLUS_SIGN:
+                return false;
+        default:
+                return !is_inline_symbol(c) && !is_superscript(c);
+        }
+}
+
+// NOTE The grammar appends words and the spaces between them to the text
+// that they’re in, so a run of them on one line is returned as one WORD,
+// to save the parser a shift and a reduction for each word and space.  A
+// run ends before a word followed by an anchor, as that anchors the word
+// alone.  The location of the token only covers the first word, as a
+// syntax error found at the token is about that word.
+static int
+words(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
+{
+        const char *first = word_end(parser, parser->p);
+        if (first == parser->p)
+                return token(parser, location, parser->p, END);
+        const char *end = first;
+        while (at(parser, end) == ' ') {
+                const char *begin = skip_spaces(parser, end);
+                if (!is_word_start(dref(parser, begin)))
+                        break;
+                const char *wend = word_end(parser, begin);
+                if (wend == begin || is_superscript(dref(parser, wend)))
+                        break;
+                end = wend;
+        }
+        int type = substring(parser, location, value, end, WORD);
+        location->end = first;
+        return type;
+}
+
 #define U_SINGLE_RIGHT_QUOTATION_MARK ((uchar)0x2019)
 
 static int
 quoted(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 {
         const char *end = parser->p + 3;
-        const char *nend;
-        if (is_end(end) ||
-            (u_dref(nend = u_next(end)) != U_SINGLE_RIGHT_QUOTATION_MARK))
-                return word(parser, location, value, parser->p);
+        if (is_end(parser, end))
+                return word(parser, location, value);
+        size_t l;
+        decode(parser, end, &l);
+        const char *nend = end + l;
+        if (dref(parser, nend) != U_SINGLE_RIGHT_QUOTATION_MARK)
+                return word(parser, location, value);
         return substring(parser, location, value, nend, WORD);
 }
 
@@ -1278,13 +1619,14 @@ code(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
         size_t compact = 0;
         size_t length = 0;
 again:
-        while (!is_end(end) &&
-               !(u_lref(end, &length) == U_SINGLE_RIGHT_POINTING_ANGLE_QUOTATION_MARK &&
+        while (!is_end(parser, end) &&
+               !(decode(parser, end, &length) ==
+                 U_SINGLE_RIGHT_POINTING_ANGLE_QUOTATION_MARK &&
                  end - begin > 0))
                 end += length;
         const char *send = end;
-        if (is_end(end)) {
-                if (!parser_error(parser, &parser->location,
+        if (is_end(parser, end)) {
+                if (!parser_error(parser, &point(parser->p),
                                   "expected ‘›’ after code inline (‹…›) content")) {
                         value->node = NULL;
                         goto oom;
@@ -1293,7 +1635,7 @@ again:
                 uchar c;
                 do {
                         end += length;
-                } while ((c = u_dref(end)) ==
+                } while ((c = dref(parser, end)) ==
                          U_SINGLE_RIGHT_POINTING_ANGLE_QUOTATION_MARK);
                 if (c == U_SINGLE_LEFT_POINTING_ANGLE_QUOTATION_MARK) {
                         if (compact == 0)
@@ -1304,32 +1646,39 @@ again:
                 }
                 send = end - length;
         }
-        value->node = text_node_new_dup(NMC_NODE_CODE, begin, send - begin);
-        if (compact > 0) {
-                char *p = ((struct nmc_text_node *)value->node)->text + compact;
+        if (compact == 0) {
+                value->node = text_node_new_substring(parser, NMC_NODE_CODE,
+                                                      begin, send - begin);
+                goto oom;
+        }
+        // NOTE Only compacted code has to be copied, as it’s rewritten.
+        char *s = nmc_arena_strndup(parser->arena, begin, send - begin);
+        if (s == NULL) {
+                value->node = NULL;
+                goto oom;
+        }
+        {
+                char *p = s + compact;
                 char *q = p + 3 * 2;
-                while (*q != '\0') {
-                        uchar c = u_lref(q, &length);
+                const char *qend = s + (send - begin);
+                while (q < qend) {
+                        uchar c = u_decode(q, qend, &length);
                         if (c == U_SINGLE_RIGHT_POINTING_ANGLE_QUOTATION_MARK) {
-                                while ((c = u_lref(q + length, &length)) ==
+                                size_t l;
+                                while ((c = u_decode(q + length, qend, &l)) ==
                                        U_SINGLE_RIGHT_POINTING_ANGLE_QUOTATION_MARK) {
                                         for (size_t i = 0; i < length; i++)
                                                 *p++ = *q++;
                                 }
                                 if (c == U_SINGLE_LEFT_POINTING_ANGLE_QUOTATION_MARK) {
-                                        // NOTE left and right are the same number of bytes
-                                        q += 3 * 2;
+                                        q += length + l;
                                         continue;
                                 }
                         }
                         for (size_t i = 0; i < length; i++)
                                 *p++ = *q++;
                 }
-                *p = '\0';
-                char *t = realloc(((struct nmc_text_node *)value->node)->text,
-                                  p - ((struct nmc_text_node *)value->node)->text + 1);
-                if (t != NULL)
-                        ((struct nmc_text_node *)value->node)->text = t;
+                value->node = text_node_new(parser, NMC_NODE_CODE, s, p - s);
         }
 oom:
         return token(parser, location, end, CODE);
@@ -1340,26 +1689,30 @@ emphasis(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 {
         const char *begin = parser->p + 1;
         const char *end = begin;
-        while (!is_end(end)) {
+        while (true) {
+                end = find(parser, end, STRUCTURE_SPECIALS);
+                if (is_end(parser, end))
+                        break;
                 if (*end == '/' && end - begin > 0) {
-                        while (*(end + 1) == '/')
+                        while (at(parser, end + 1) == '/')
                                 end++;
-                        if (is_space_or_end(end + 1) ||
-                            !uc_isaletterornumeric(u_dref(end + 1)))
+                        if (is_space_or_end(parser, end + 1) ||
+                            !uc_isaletterornumeric(dref(parser, end + 1)))
                                 break;
                 }
                 end++;
         }
         const char *send = end;
-        if (is_end(end)) {
-                if (!parser_error(parser, &parser->location,
+        if (is_end(parser, end)) {
+                if (!parser_error(parser, &point(parser->p),
                                   "expected ‘/’ after emphasized text (/…/)")) {
                         value->node = NULL;
                         goto oom;
                 }
         } else
                 end++;
-        value->node = text_node_new_dup(NMC_NODE_EMPHASIS, begin, send - begin);
+        value->node = text_node_new_substring(parser, NMC_NODE_EMPHASIS, begin,
+                                              send - begin);
 oom:
         return token(parser, location, end, EMPHASIS);
 }
@@ -1368,32 +1721,30 @@ struct anchor_node {
         struct nmc_parent_node node;
         union {
                 struct anchor *anchor;
-                struct nmc_node_data *data;
+                struct nmc_node_datum *data;
         } u;
 };
 
 static struct nmc_node *
-anchor_node_new(YYLTYPE *location, const char *string, size_t length)
+anchor_node_new(struct parser *parser, YYLTYPE *location, const char *string,
+                size_t length)
 {
-        struct anchor_node *n = node_new(struct anchor_node,
+        struct anchor_node *n = node_new(parser, struct anchor_node,
                                          NMC_NODE_TYPE_PRIVATE,
                                          NMC_NODE_ANCHOR);
         if (n == NULL)
                 return NULL;
         n->node.children = NULL;
-        n->u.anchor = malloc(sizeof(struct anchor));
-        if (n->u.anchor == NULL) {
-                free(n);
+        n->u.anchor = nmc_arena_alloc(parser->arena, sizeof(struct anchor));
+        if (n->u.anchor == NULL)
                 return NULL;
-        }
         n->u.anchor->next = NULL;
+        n->u.anchor->previous = NULL;
+        n->u.anchor->same = NULL;
         n->u.anchor->location = *location;
-        char *id = mstrdup(string, length);
-        if (id == NULL) {
-                free(n->u.anchor);
-                free(n);
+        char *id = nmc_arena_strndup(parser->arena, string, length);
+        if (id == NULL)
                 return NULL;
-        }
         n->u.anchor->id = id_new(id);
         n->u.anchor->node = n;
         return (struct nmc_node *)n;
@@ -1403,18 +1754,21 @@ static int
 parser_lex(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
 {
         if (parser->dedents > 0)
-                return dedent(parser, location, parser->p, parser->p);
+                return dedent(parser, location, parser->p);
 
         if (parser->bol)
                 return bol(parser, location, value);
 
         size_t length;
-        uchar c = u_lref(parser->p, &length);
+        uchar c = decode(parser, parser->p, &length);
         switch (c) {
+        case '\0':
+                if (parser->p < parser->end)
+                        return nul(parser);
+                break;
         case ' ': {
                 const char *end = parser->p + length;
-                while (*end == ' ')
-                        end++;
+                end = skip_spaces(parser, end);
                 return substring(parser, location, value, end, SPACE);
         }
         case '\n':
@@ -1436,14 +1790,14 @@ parser_lex(struct parser *parser, YYLTYPE *location, YYSTYPE *value)
         }
 
         if (is_superscript(c)) {
-                length += superscript(parser->p + length);
+                length += superscript(parser, parser->p + length);
                 const char *begin = parser->p;
                 int r = token(parser, location, parser->p + length, ANCHOR);
-                value->node = anchor_node_new(location, begin, length);
+                value->node = anchor_node_new(parser, location, begin, length);
                 return r;
         }
 
-        return word(parser, location, value, parser->p);
+        return words(parser, location, value);
 }
 
 static int
@@ -1461,6 +1815,12 @@ nmc_grammar_lex(YYSTYPE *value, YYLTYPE *location, struct parser *parser)
 static void
 nmc_grammar_error(YYLTYPE *location, struct parser *parser, const char *message)
 {
+        // NOTE When yyparse() can’t allocate the push parser’s state, it
+        // reports it at a default location, which for spans is null.
+        if (location->begin == NULL) {
+                parser_oom(parser);
+                return;
+        }
         parser_error(parser, location, "%s", message);
 }
 
@@ -1486,12 +1846,25 @@ siblings(struct nodes siblings, struct nodes rest)
         return (struct nodes){ siblings.first, rest.last };
 }
 
+// NOTE Either may be empty, as sections that have been streamed are left
+// out of the tree.
+static inline struct nodes
+osiblings(struct nodes siblings, struct nodes rest)
+{
+        if (siblings.last == NULL)
+                return rest;
+        if (rest.last == NULL)
+                return siblings;
+        siblings.last->next = rest.first;
+        return (struct nodes){ siblings.first, rest.last };
+}
+
 static inline struct nmc_node *
-parent1(enum nmc_node_name name, struct nmc_node *children)
+parent1(struct parser *parser, enum nmc_node_name name, struct nmc_node *children)
 {
         if (children == NULL)
                 return NULL;
-        struct nmc_parent_node *n = node_new(struct nmc_parent_node,
+        struct nmc_parent_node *n = node_new(parser, struct nmc_parent_node,
                                              NMC_NODE_TYPE_PARENT, name);
         if (n == NULL)
                 return NULL;
@@ -1500,24 +1873,102 @@ parent1(enum nmc_node_name name, struct nmc_node *children)
 }
 
 static inline struct nmc_node *
-parent(enum nmc_node_name name, struct nodes children)
+parent(struct parser *parser, enum nmc_node_name name, struct nodes children)
 {
-        return parent1(name, children.first);
+        return parent1(parser, name, children.first);
 }
 
 static inline struct nmc_node *
-parent_children(enum nmc_node_name name, struct nmc_node *first, struct nodes rest)
+parent_children(struct parser *parser, enum nmc_node_name name,
+                struct nmc_node *first, struct nodes rest)
 {
         first->next = rest.first;
-        return parent1(name, first);
+        return parent1(parser, name, first);
+}
+
+static void
+stream_title(struct parser *parser, struct nmc_node *title)
+{
+        if (parser->stream == NULL)
+                return;
+        parser->stream->title = title;
+        parser->stream->mark = nmc_arena_mark(parser->arena);
+}
+
+static void
+stream_blocks(struct parser *parser, struct nodes blocks)
+{
+        if (parser->stream == NULL)
+                return;
+        parser->stream->title->next = blocks.first;
+        parser->stream->mark = nmc_arena_mark(parser->arena);
+}
+
+// NOTE Once there are errors, the output is incomplete anyway, so nothing
+// more is written, but sections are still released.
+static bool
+stream_section(struct parser *parser, struct nmc_node *section,
+               struct nodes *sections)
+{
+        struct stream *stream = parser->stream;
+        if (stream == NULL) {
+                *sections = nodes(section);
+                return true;
+        }
+        *sections = nodes(NULL);
+        if (parser->errors.first == NULL) {
+                bool r = (stream->begun ||
+                          xml_document_begin(parser->context, stream->title,
+                                             stream->output, stream->error)) &&
+                        xml_document_section(parser->context, section,
+                                             stream->output, stream->error);
+                stream->begun = true;
+                if (!r) {
+                        stream->failed = true;
+                        return false;
+                }
+        }
+        nmc_arena_release(parser->arena, stream->mark);
+        return true;
+}
+
+static bool
+stream_end(struct parser *parser)
+{
+        struct stream *stream = parser->stream;
+        if (stream == NULL || parser->errors.first != NULL)
+                return true;
+        bool r = stream->begun ?
+                xml_document_end(parser->context, stream->output, stream->error) :
+                nmc_node_xml(parser->context, parser->doc, stream->output,
+                             stream->error);
+        stream->failed = !r;
+        return r;
+}
+
+// NOTE Once a top-level section has been reduced, its text has been
+// copied, as a push parser doesn’t reference its input, and its errors
+// have been located, so only the lookahead, which was lexed from the
+// current buffer, refers to the input.  The list is newest first, so the
+// buffers after the first one already freed were freed before it.
+static void
+free_moved(struct parser *parser)
+{
+        list_for_each(struct moved, m, parser->moved) {
+                if (m->freed)
+                        break;
+                free((char *)m->input);
+                m->freed = true;
+        }
 }
 
 static void
 clear_anchors(struct parser *parser)
 {
         struct nmc_parser_error *first = NULL, *previous = NULL, *last = NULL;
-        list_for_each_safe(struct anchor, p, n, parser->anchors) {
-                first = nmc_parser_error_new(&p->location,
+        list_for_each_safe(struct anchor, p, n, parser->anchors.first) {
+                struct nmc_location l = parser_location(parser, &p->location);
+                first = nmc_parser_error_new(&l,
                                              "undefined footnote ‘%s’",
                                              p->id.string);
                 if (first == NULL) {
@@ -1533,82 +1984,93 @@ clear_anchors(struct parser *parser)
         }
         if (first != NULL)
                 parser_errors(parser, first, last);
-        parser->anchors = NULL;
+        parser->anchors.first = NULL;
+        table_clear(&parser->anchors.ids);
 }
 
 static bool
 update_anchors(struct parser *parser, struct footnote *footnote)
 {
-        bool found = false;
-        struct anchor *p = NULL;
-        list_for_each_safe(struct anchor, c, n, parser->anchors) {
-                if (id_eq(&c->id, &footnote->id)) {
-                        if (footnote->node != NULL) {
-                                c->node->node.node.type = footnote->node->node.node.type;
-                                c->node->node.node.name = footnote->node->node.node.name;
-                                c->node->u.data = footnote->node->data;
-                                c->node->u.data->references++;
-                                c->node = NULL;
-                        } else
-                                c->node->u.anchor = NULL;
-                        if (p == NULL)
-                                parser->anchors = n;
-                        else
-                                p->next = n;
-                        anchor_free1(c);
-                        found = true;
+        void **same = table_find(&parser->anchors.ids, &footnote->id);
+        if (same == NULL || *same == NULL)
+                return parser_error(parser, &footnote->location,
+                                    "footnote ‘%s’ defined but not used",
+                                    footnote->id.string);
+        for (struct anchor *c = *same; c != NULL; c = c->same) {
+                if (footnote->node != NULL) {
+                        c->node->node.node.type = footnote->node->node.node.type;
+                        c->node->node.node.name = footnote->node->node.node.name;
+                        c->node->u.data = footnote->node->data;
                 } else
-                        p = c;
+                        c->node->u.anchor = NULL;
+                if (c->previous == NULL)
+                        parser->anchors.first = c->next;
+                else
+                        c->previous->next = c->next;
+                if (c->next != NULL)
+                        c->next->previous = c->previous;
         }
-        return found || parser_error(parser, &footnote->location,
-                                     "footnote ‘%s’ defined but not used",
-                                     footnote->id.string);
+        *same = NULL;
+        return true;
 }
 
 static bool
-reference(struct parser *parser, struct footnote **footnotes)
+reference(struct parser *parser, struct footnote *footnotes)
 {
-        list_for_each_safe(struct footnote, p, n, *footnotes) {
-                if (!update_anchors(parser, p)) {
-                        *footnotes = p;
+        list_for_each(struct footnote, p, footnotes)
+                if (!update_anchors(parser, p))
                         return false;
-                }
-                footnote_free1(p);
-        }
         return true;
 }
 
+// NOTE Only one run of footnotes is collected at a time, so the parser
+// keeps the last one of it and a table of their ids.
+static inline struct footnote *
+fnodes(struct parser *parser, struct footnote *footnote)
+{
+        if (footnote == NULL)
+                return NULL;
+        table_clear(&parser->footnotes.ids);
+        void **p = table_insert(&parser->footnotes.ids, &footnote->id);
+        if (p == NULL)
+                return NULL;
+        *p = footnote;
+        parser->footnotes.last = footnote;
+        return footnote;
+}
+
 static inline NON_NULL((2)) struct footnote *
 fibling(struct parser *parser, struct footnote *footnotes, struct footnote *footnote)
 {
         if (footnote == NULL)
                 return NULL;
-        struct footnote *last = NULL;
-        list_for_each(struct footnote, p, footnotes) {
-                if (id_eq(&footnote->id, &p->id)) {
-                        if (!parser_error(parser, &footnote->location,
-                                          "redefinition of footnote ‘%s’",
-                                          p->id.string))
-                                return NULL;
-                        if (!parser_error(parser, &p->location,
-                                          "previous definition of footnote ‘%s’ was here",
-                                          p->id.string))
-                                return NULL;
-                        footnote_free1(footnote);
-                        return footnotes;
-                }
-                last = p;
+        void **previous = table_insert(&parser->footnotes.ids, &footnote->id);
+        if (previous == NULL)
+                return NULL;
+        if (*previous != NULL) {
+                struct footnote *p = *previous;
+                if (!parser_error(parser, &footnote->location,
+                                  "redefinition of footnote ‘%s’",
+                                  p->id.string))
+                        return NULL;
+                if (!parser_error(parser, &p->location,
+                                  "previous definition of footnote ‘%s’ was here",
+                                  p->id.string))
+                        return NULL;
+                return footnotes;
         }
-        last->next = footnote;
+        *previous = footnote;
+        parser->footnotes.last->next = footnote;
+        parser->footnotes.last = footnote;
         return footnotes;
 }
 
 static struct nmc_node *
-definition(struct nmc_node *term, struct nmc_node *item)
+definition(struct parser *parser, struct nmc_node *term, struct nmc_node *item)
 {
         if (term == NULL)
                 return NULL;
-        term->next = parent1(NMC_NODE_DEFINITION, nmc_node_children(item));
+        term->next = parent1(parser, NMC_NODE_DEFINITION, nmc_node_children(item));
         if (term->next == NULL)
                 return NULL;
         nmc_node_children(item) = term;
@@ -1621,8 +2083,16 @@ anchor(struct parser *parser, struct nmc_node *atom, struct nmc_node *anchor)
         if (anchor == NULL)
                 return NULL;
         nmc_node_children(anchor) = atom;
-        ((struct anchor_node *)anchor)->u.anchor->next = parser->anchors;
-        parser->anchors = ((struct anchor_node *)anchor)->u.anchor;
+        struct anchor *a = ((struct anchor_node *)anchor)->u.anchor;
+        void **same = table_insert(&parser->anchors.ids, &a->id);
+        if (same == NULL)
+                return NULL;
+        a->same = *same;
+        *same = a;
+        a->next = parser->anchors.first;
+        if (a->next != NULL)
+                a->next->previous = a;
+        parser->anchors.first = a;
         return anchor;
 }
 
@@ -1631,51 +2101,31 @@ wanchor(struct parser *parser, struct substring substring, struct nmc_node *a)
 {
         if (a == NULL)
                 return NULL;
-        struct nmc_node *n = text_node_new_dup(NMC_NODE_TEXT, substring.string, substring.length);
+        struct nmc_node *n = text_node_new_substring(parser, NMC_NODE_TEXT,
+                                                     substring.string,
+                                                     substring.length);
         if (n == NULL)
                 return NULL;
-        struct nmc_node *r = anchor(parser, n, a);
-        if (r == NULL) {
-                nmc_node_free(n);
-                return NULL;
-        }
-        return r;
+        return anchor(parser, n, a);
 }
 
 struct buffer_node {
-        struct nmc_node node;
-        union {
-                char *text;
-                struct buffer *buffer;
-        } u;
+        struct nmc_text_node node;
+        struct nmc_text *last;
 };
 
-static void
-buffer_to_text(struct buffer_node *buffer)
-{
-        buffer->node.type = NMC_NODE_TYPE_TEXT;
-        buffer->node.name = NMC_NODE_TEXT;
-        buffer->u.text = buffer_str(buffer->u.buffer);
-}
-
 static struct nmc_node *
 buffer(struct parser *parser, struct substring substring)
 {
-        struct buffer_node *n = node_new(struct buffer_node,
+        struct buffer_node *n = node_new(parser, struct buffer_node,
                                          NMC_NODE_TYPE_PRIVATE,
                                          NMC_NODE_BUFFER);
         if (n == NULL)
                 return NULL;
-        if (parser->buffer_node != NULL)
-                buffer_to_text(parser->buffer_node);
-        n->u.buffer = &parser->buffer;
-        *n->u.buffer = (struct buffer)BUFFER_INIT;
-        if (!buffer_append(n->u.buffer, substring.string, substring.length)) {
-                free(n);
-                parser->buffer_node = NULL;
-                return NULL;
-        }
-        parser->buffer_node = n;
+        n->node.text.next = NULL;
+        n->node.text.string = substring.string;
+        n->node.text.length = substring.length;
+        n->last = &n->node.text;
         return (struct nmc_node *)n;
 }
 
@@ -1686,8 +2136,9 @@ append_text(struct parser *parser, struct nodes inlines, struct substring substr
                 return inlines;
         if (inlines.last->name != NMC_NODE_BUFFER)
                 return sibling(inlines, buffer(parser, substring));
-        if (!buffer_append(((struct buffer_node *)inlines.last)->u.buffer,
-                           substring.string, substring.length))
+        struct buffer_node *b = (struct buffer_node *)inlines.last;
+        if ((b->last = text_append(parser, b->last, substring.string,
+                                   substring.length)) == NULL)
                 return nodes(NULL);
         return inlines;
 }
@@ -1698,8 +2149,11 @@ textify(struct parser *parser, struct nodes inlines)
         if (inlines.last == NULL)
                 return inlines;
         if (inlines.last->name == NMC_NODE_BUFFER) {
-                buffer_to_text((struct buffer_node *)inlines.last);
-                parser->buffer_node = NULL;
+                inlines.last->type = NMC_NODE_TYPE_TEXT;
+                inlines.last->name = NMC_NODE_TEXT;
+                if (!parser_references_input(parser) &&
+                    !text_copy(parser, &((struct nmc_text_node *)inlines.last)->text))
+                        return nodes(NULL);
         }
         return inlines;
 }
@@ -1714,12 +2168,23 @@ textify(struct parser *parser, struct nodes inlines)
 }
 %%
 
+// NOTE SECTIONS is never lexed, but pushed first by parse_sections(), so
+// that a part of the input that begins with a top-level section can be
+// parsed on its own.
+start: nmc
+| SECTIONS sections0 { M(parser->doc = parent(parser, NMC_NODE_DOCUMENT, $2)); };
+
 nmc: ospace documenttitle oblockssections0 {
-        M(parser->doc = parent_children(NMC_NODE_DOCUMENT, $2, $3));
+        M(parser->doc = parent_children(parser, NMC_NODE_DOCUMENT, $2, $3));
         clear_anchors(parser);
+        if (!stream_end(parser))
+                YYABORT;
 };
 
-documenttitle: words { M($$ = parent1(NMC_NODE_TITLE, textify(parser, $1).first)); };
+documenttitle: words {
+        M($$ = parent1(parser, NMC_NODE_TITLE, textify(parser, $1).first));
+        stream_title(parser, $$);
+};
 
 words: WORD { N($$ = nodes(buffer(parser, $1))); }
 | words WORD { N($$ = append_text(parser, $1, $2)); }
@@ -1729,11 +2194,18 @@ oblockssections0: /* empty */ { $$ = nodes(NULL); }
 | blockssections0 { $$ = $1; };
 
 blockssections0: blocks
-| blocks { clear_anchors(parser); } sections0 { $$ = siblings($1, $3); }
+| blocks { clear_anchors(parser); stream_blocks(parser, $1); } sections0 { $$ = osiblings($1, $3); }
 | sections0;
 
-sections0: footnotedsection { clear_anchors(parser); $$ = nodes($1); }
-| sections0 { clear_anchors(parser); } footnotedsection { $$ = sibling($1, $3); };
+sections0: topsection
+| sections0 topsection { $$ = osiblings($1, $2); };
+
+topsection: footnotedsection {
+        clear_anchors(parser);
+        free_moved(parser);
+        if (!stream_section(parser, $1, &$$))
+                YYABORT;
+};
 
 blockssections: blocks
 | blocks sections { $$ = siblings($1, $2); }
@@ -1741,31 +2213,31 @@ blockssections: blocks
 
 blocks: block { $$ = nodes($1); }
 | blocks block { $$ = sibling($1, $2); }
-| blocks footnotes %prec NotFootnote { N($$ = reference(parser, &$2) ? $1 : nodes(NULL)); };
+| blocks footnotes %prec NotFootnote { N($$ = reference(parser, $2) ? $1 : nodes(NULL)); };
 
-block: PARAGRAPH inlines { M($$ = parent(NMC_NODE_PARAGRAPH, $2)); }
-| itemizationitems %prec NotBlock { M($$ = parent(NMC_NODE_ITEMIZATION, $1)); }
-| enumerationitems %prec NotBlock { M($$ = parent(NMC_NODE_ENUMERATION, $1)); }
-| definitionitems %prec NotBlock { M($$ = parent(NMC_NODE_DEFINITIONS, $1)); }
-| quotecontent { M($$ = parent(NMC_NODE_QUOTE, $1)); }
+block: PARAGRAPH inlines { M($$ = parent(parser, NMC_NODE_PARAGRAPH, $2)); }
+| itemizationitems %prec NotBlock { M($$ = parent(parser, NMC_NODE_ITEMIZATION, $1)); }
+| enumerationitems %prec NotBlock { M($$ = parent(parser, NMC_NODE_ENUMERATION, $1)); }
+| definitionitems %prec NotBlock { M($$ = parent(parser, NMC_NODE_DEFINITIONS, $1)); }
+| quotecontent { M($$ = parent(parser, NMC_NODE_QUOTE, $1)); }
 | CODEBLOCK { M($$ = $1); }
-| headbody { M($$ = parent(NMC_NODE_TABLE, $1)); }
-| figure { M($$ = parent(NMC_NODE_FIGURE, $1)); };
+| headbody { M($$ = parent(parser, NMC_NODE_TABLE, $1)); }
+| figure { M($$ = parent(parser, NMC_NODE_FIGURE, $1)); };
 
 sections: footnotedsection { $$ = nodes($1); }
 | sections footnotedsection { $$ = sibling($1, $2); };
 
 footnotedsection: section
-| section footnotes { M($$ = reference(parser, &$2) ? $1 : NULL); };
+| section footnotes { M($$ = reference(parser, $2) ? $1 : NULL); };
 
-section: SECTION { parser->want = INDENT; } title oblockssections { M($$ = parent_children(NMC_NODE_SECTION, $3, $4)); };
+section: SECTION { parser->want = INDENT; } title oblockssections { M($$ = parent_children(parser, NMC_NODE_SECTION, $3, $4)); };
 
-title: inlines { M($$ = parent(NMC_NODE_TITLE, $1)); };
+title: inlines { M($$ = parent(parser, NMC_NODE_TITLE, $1)); };
 
 oblockssections: /* empty */ { $$ = nodes(NULL); }
 | INDENT blockssections DEDENT { $$ = $2; };
 
-footnotes: FOOTNOTE { M($$ = $1); }
+footnotes: FOOTNOTE { M($$ = fnodes(parser, $1)); }
 | footnotes FOOTNOTE { M($$ = fibling(parser, $1, $2)); };
 
 itemizationitems: itemizationitem { $$ = nodes($1); }
@@ -1781,7 +2253,7 @@ enumerationitem: ENUMERATION item { $$ = $2; };
 definitionitems: definition { $$ = nodes($1); }
 | definitionitems definition { $$ = sibling($1, $2); };
 
-definition: TERM item { M($$ = definition($1, $2)); };
+definition: TERM item { M($$ = definition(parser, $1, $2)); };
 
 quotecontent: lines %prec NotBlock
 | lines attribution { $$ = sibling($1, $2); };
@@ -1789,26 +2261,26 @@ quotecontent: lines %prec NotBlock
 lines: line { $$ = nodes($1); }
 | lines line { $$ = sibling($1, $2); };
 
-line: QUOTE inlines { M($$ = parent(NMC_NODE_LINE, $2)); };
+line: QUOTE inlines { M($$ = parent(parser, NMC_NODE_LINE, $2)); };
 
-attribution: ATTRIBUTION inlines { M($$ = parent(NMC_NODE_ATTRIBUTION, $2)); };
+attribution: ATTRIBUTION inlines { M($$ = parent(parser, NMC_NODE_ATTRIBUTION, $2)); };
 
 headbody: head body { $$ = sibling(nodes($1), $2); }
 | body { $$ = nodes($1); };
 
-head: row TABLESEPARATOR { M($$ = parent1(NMC_NODE_HEAD, $1)); };
+head: row TABLESEPARATOR { M($$ = parent1(parser, NMC_NODE_HEAD, $1)); };
 
-body: rows %prec NotBlock { M($$ = parent(NMC_NODE_BODY, $1)); };
+body: rows %prec NotBlock { M($$ = parent(parser, NMC_NODE_BODY, $1)); };
 
 rows: row { $$ = nodes($1); }
 | rows row { $$ = sibling($1, $2); };
 
-row: ROW cells CELLSEPARATOR { M($$ = parent(NMC_NODE_ROW, $2)); };
+row: ROW cells CELLSEPARATOR { M($$ = parent(parser, NMC_NODE_ROW, $2)); };
 
 cells: cell { $$ = nodes($1); }
 | cells CELLSEPARATOR cell { $$ = sibling($1, $3); };
 
-cell: inlines { M($$ = parent(NMC_NODE_CELL, $1)); };
+cell: inlines { M($$ = parent(parser, NMC_NODE_CELL, $1)); };
 
 figure: FIGURE title { N($$ = sibling(nodes($2), $1)); };
 
@@ -1830,14 +2302,14 @@ anchoredinline: inline ANCHOR { M($$ = anchor(parser, $1, $2)); }
 
 inline: CODE { M($$ = $1); }
 | EMPHASIS { M($$ = $1); }
-| BEGINGROUP sinlines ENDGROUP { M($$ = parent(NMC_NODE_GROUP, textify(parser, $2))); };
+| BEGINGROUP sinlines ENDGROUP { M($$ = parent(parser, NMC_NODE_GROUP, textify(parser, $2))); };
 
 ospace: /* empty */
 | SPACE;
 
-item: { parser->want = ITEMINDENT; } firstparagraph oblocks { M($$ = parent_children(NMC_NODE_ITEM, $2, $3)); };
+item: { parser->want = ITEMINDENT; } firstparagraph oblocks { M($$ = parent_children(parser, NMC_NODE_ITEM, $2, $3)); };
 
-firstparagraph: inlines { M($$ = parent(NMC_NODE_PARAGRAPH, $1)); };
+firstparagraph: inlines { M($$ = parent(parser, NMC_NODE_PARAGRAPH, $1)); };
 
 oblocks: /* empty */ { $$ = nodes(NULL); }
 | ITEMINDENT blocks DEDENT { $$ = $2; };
@@ -1894,141 +2366,860 @@ token_name(int type)
         return r;
 }
 
-struct nmc_node *
-nmc_parse(const char *input, struct nmc_parser_error **errors)
+static struct nmc_document *
+parser_init(struct parser *parser, const struct nmc_context *context,
+            const char *input, size_t length, unsigned int flags)
+{
+        parser->context = context;
+        // NOTE nmc_parser_oom_error is shared by all parsers, so each one
+        // allocates its own up front, while memory is still available, to
+        // have something to report with a location.
+        parser->oom = nmc_parser_error_new(&(struct nmc_location){ 1, 1, 1, 1 }, "%s",
+                                           nmc_parser_oom_error.message);
+        parser->arena = parser->oom == NULL ? NULL : nmc_arena_new();
+        struct nmc_document *document = parser->arena == NULL ? NULL :
+                nmc_arena_alloc(parser->arena, sizeof(struct nmc_document));
+        if (document == NULL) {
+                nmc_arena_free(parser->arena);
+                nmc_parser_error_free(parser->oom);
+                return NULL;
+        }
+        parser->flags = flags;
+        parser->input = input;
+        parser->p = input;
+        parser->end = input + length;
+        parser->first = input;
+        parser->lines = (struct lines){ NULL, 0 };
+        // NOTE Without memory for the index, the lexer scans byte by byte.
+        structure_init(&parser->structure, input, input + length,
+                       STRUCTURE_WINDOW);
+        parser->dedents = 0;
+        parser->indent = 0;
+        parser->bol = false;
+        parser->want = ERROR;
+        parser->more = false;
+        parser->starved = false;
+        parser->resume.p = NULL;
+        parser->moved = NULL;
+        parser->stream = NULL;
+        parser->doc = NULL;
+        parser->scratch = (struct buffer)BUFFER_INIT;
+        parser->anchors.first = NULL;
+        parser->anchors.ids = (struct table)TABLE_INIT;
+        parser->footnotes.last = NULL;
+        parser->footnotes.ids = (struct table)TABLE_INIT;
+        parser->errors.first = parser->errors.last = NULL;
+        return document;
+}
+
+static struct nmc_document *
+parser_finish(struct parser *parser, struct nmc_document *document,
+              struct nmc_parser_error **errors)
+{
+        free(parser->scratch.content);
+        free(parser->lines.begins);
+        structure_release(&parser->structure);
+        free(parser->anchors.ids.entries);
+        free(parser->footnotes.ids.entries);
+        if (!parser_is_oom(parser))
+                nmc_parser_error_free(parser->oom);
+        *errors = parser->errors.first;
+        if (*errors != NULL) {
+                nmc_arena_free(parser->arena);
+                return NULL;
+        }
+        document->root = parser->doc;
+        document->arena = parser->arena;
+        return document;
+}
+
+struct nmc_document *
+nmc_parse_n(const struct nmc_context *context, const char *input,
+            size_t length, unsigned int flags,
+            struct nmc_parser_error **errors)
 {
         struct parser parser;
-        parser.p = input;
-        parser.location = (YYLTYPE){ 1, 1, 1, 1 };
-        parser.dedents = 0;
-        parser.indent = 0;
-        parser.bol = false;
-        parser.want = ERROR;
-        parser.doc = NULL;
-        parser.buffer_node = NULL;
-        parser.anchors = NULL;
-        parser.errors.first = parser.errors.last = NULL;
-
-        nmc_grammar_parse(&parser);
-
-        *errors = parser.errors.first;
-        if (*errors != NULL) {
-                nmc_node_free(parser.doc);
+        struct nmc_document *document = parser_init(&parser, context, input,
+                                                    length, flags);
+        if (document == NULL) {
+                *errors = &nmc_parser_oom_error;
                 return NULL;
         }
-        return parser.doc;
+        nmc_grammar_parse(&parser);
+        return parser_finish(&parser, document, errors);
 }
 
 bool
-nmc_initialize(struct nmc_error *error)
+nmc_parse_xml(const struct nmc_context *context, const char *input,
+              size_t length, unsigned int flags, struct nmc_output *output,
+              struct nmc_parser_error **errors, struct nmc_error *error)
 {
-        return definitions_init(error);
+        struct parser parser;
+        struct nmc_document *document = parser_init(&parser, context, input,
+                                                    length, flags);
+        if (document == NULL) {
+                *errors = &nmc_parser_oom_error;
+                return false;
+        }
+        struct stream stream = {
+                output, error, nmc_arena_mark(parser.arena), NULL, false, false
+        };
+        parser.stream = &stream;
+        nmc_grammar_parse(&parser);
+        document = parser_finish(&parser, document, errors);
+        if (document == NULL)
+                return false;
+        nmc_document_free(document);
+        return !stream.failed;
 }
 
-void
-nmc_finalize(void)
+// NOTE A malformed multibyte character takes in as many bytes as its
+// first byte says, newlines included, so a newline only surely ends a line
+// if none of the bytes before it reaches that far.
+static bool
+ends_line(const char *begin, const char *p)
 {
-        definitions_free();
+        for (size_t i = 1; i <= 6 && i <= (size_t)(p - begin); i++)
+                if ((size_t)u_skip_lengths[(unsigned char)p[-i]] > i)
+                        return false;
+        return true;
 }
 
-char *
-nmc_location_str(const struct nmc_location *l)
+// NOTE A top-level section begins with “§ ” at the beginning of a line.
+// Inside anything else, such a line would be indented.
+static PURE const char *
+next_section(const char *begin, const char *p, const char *end)
 {
-        char *s;
-        if (l->first_line == l->last_line) {
-                if (l->first_column == l->last_column)
-                        asprintf(&s, "%d:%d", l->first_line, l->first_column);
-                else
-                        asprintf(&s, "%d.%d-%d", l->first_line, l->first_column, l->last_column);
-        } else
-                asprintf(&s, "%d.%d-%d.%d", l->first_line, l->first_column, l->last_line, l->last_column);
-        return s;
+        while ((p = memchr(p, '\n', end - p)) != NULL) {
+                bool line = ends_line(begin, p);
+                p++;
+                if (line && end - p >= 3 && p[0] == '\xc2' &&
+                    p[1] == '\xa7' && p[2] == ' ')
+                        return p;
+        }
+        return end;
 }
 
-static struct nmc_node *
-parent_node_free(struct nmc_parent_node *node, UNUSED(struct parser *parser))
+static PURE struct nmc_node *
+last_child(struct nmc_node *node)
 {
-        return node->children;
+        struct nmc_node *last = ((struct nmc_parent_node *)node)->children;
+        while (last != NULL && last->next != NULL)
+                last = last->next;
+        return last;
 }
 
-static struct nmc_node *
-data_node_free(struct nmc_data_node *node, struct parser *parser)
+// NOTE A part of the input that begins with a top-level section is lexed
+// as it would be when the lexer got to it after the section before, at
+// the beginning of a line, without indent.
+static struct nmc_document *
+parse_sections(const struct nmc_context *context, const char *input,
+               size_t length, unsigned int flags,
+               struct nmc_parser_error **errors)
 {
-        node_data_free(node->data);
-        return parent_node_free((struct nmc_parent_node *)node, parser);
+        struct parser parser;
+        struct nmc_document *document = parser_init(&parser, context, input,
+                                                    length, flags);
+        if (document == NULL) {
+                *errors = &nmc_parser_oom_error;
+                return NULL;
+        }
+        parser.bol = true;
+        nmc_grammar_pstate *state = nmc_grammar_pstate_new();
+        if (state == NULL) {
+                parser_oom(&parser);
+        } else {
+                YYSTYPE value;
+                YYLTYPE location = point(input);
+                int token = SECTIONS;
+                int status;
+                while ((status = nmc_grammar_push_parse(state, token, &value,
+                                                        &location,
+                                                        &parser)) == YYPUSH_MORE)
+                        token = nmc_grammar_lex(&value, &location, &parser);
+                nmc_grammar_pstate_delete(state);
+        }
+        return parser_finish(&parser, document, errors);
 }
 
-static struct nmc_node *
-text_node_free(struct nmc_text_node *node, UNUSED(struct parser *parser))
-{
-        free(node->text);
+#ifdef HAVE_PTHREAD
+struct part {
+        const char *input;
+        size_t length;
+        struct nmc_document *document;
+        struct nmc_parser_error *errors;
+};
+
+struct parts {
+        const struct nmc_context *context;
+        unsigned int flags;
+        struct part *parts;
+        size_t n;
+        size_t next;
+        pthread_mutex_t mutex;
+};
+
+static void *
+parts_worker(void *closure)
+{
+        struct parts *parts = closure;
+        pthread_mutex_lock(&parts->mutex);
+        while (parts->next < parts->n) {
+                size_t i = parts->next++;
+                pthread_mutex_unlock(&parts->mutex);
+                struct part *part = &parts->parts[i];
+                if (i == 0)
+                        part->document = nmc_parse_n(parts->context,
+                                                     part->input, part->length,
+                                                     parts->flags,
+                                                     &part->errors);
+                else
+                        part->document = parse_sections(parts->context,
+                                                        part->input,
+                                                        part->length,
+                                                        parts->flags,
+                                                        &part->errors);
+                pthread_mutex_lock(&parts->mutex);
+        }
+        pthread_mutex_unlock(&parts->mutex);
         return NULL;
 }
 
-static struct nmc_node *
-private_node_free(struct nmc_node *node, struct parser *parser)
-{
-        switch (node->name) {
-        case NMC_NODE_BUFFER:
-                if (parser != NULL &&
-                    parser->buffer_node == (struct buffer_node *)node)
-                        parser->buffer_node = NULL;
-                free(((struct buffer_node *)node)->u.buffer->content);
+#define PARALLEL_PART_SIZE (64 * 1024)
+
+// NOTE Splits input at top-level sections into at most n parts of about
+// length / n bytes, but no smaller than PARALLEL_PART_SIZE, and returns how
+// many there are.  As parts are never shorter than that, a short remainder
+// may be left over after n of them, so the last part takes all the rest.
+static size_t
+parts_split(struct part *parts, size_t n, const char *input, size_t length)
+{
+        size_t size = length / n;
+        if (size < PARALLEL_PART_SIZE)
+                size = PARALLEL_PART_SIZE;
+        const char *end = input + length;
+        size_t m = 0;
+        for (const char *p = input; p < end; m++) {
+                const char *q = m < n - 1 && (size_t)(end - p) > size ?
+                        next_section(input, p + size - 1, end) : end;
+                parts[m] = (struct part){ p, q - p, NULL, NULL };
+                p = q;
+        }
+        return m;
+}
+
+// NOTE The first part is parsed as a document and the rest as top-level
+// sections, whose anchors can’t refer to footnotes outside of them.  Each
+// part is parsed into an arena of its own, which the first part’s then
+// adopts, and its sections are appended to the first part’s document.
+// Constructs that reach across the end of a part, like an unterminated
+// code inline, are errors in it, so if any part has errors, the whole
+// input is parsed again, to report the same errors, in the same order, at
+// the same locations, as nmc_parse_n() would.
+struct nmc_document *
+nmc_parse_parallel(const struct nmc_context *context, const char *input,
+                   size_t length, unsigned int flags, size_t threads,
+                   struct nmc_parser_error **errors)
+{
+        if (threads < 2 || length < 2 * PARALLEL_PART_SIZE)
+                return nmc_parse_n(context, input, length, flags, errors);
+        // NOTE More parts than threads even out sections of different
+        // sizes.
+        size_t n = 4 * threads;
+        struct parts parts = { context, flags, malloc(n * sizeof(struct part)),
+                               0, 0, PTHREAD_MUTEX_INITIALIZER };
+        pthread_t *workers = malloc((threads - 1) * sizeof(pthread_t));
+        if (parts.parts == NULL || workers == NULL) {
+                free(workers);
+                free(parts.parts);
+                return nmc_parse_n(context, input, length, flags, errors);
+        }
+        parts.n = parts_split(parts.parts, n, input, length);
+        size_t started = 0;
+        while (started < threads - 1 && started + 1 < parts.n &&
+               pthread_create(&workers[started], NULL, parts_worker,
+                              &parts) == 0)
+                started++;
+        parts_worker(&parts);
+        for (size_t i = 0; i < started; i++)
+                pthread_join(workers[i], NULL);
+        free(workers);
+
+        bool failed = false;
+        for (size_t i = 0; i < parts.n; i++)
+                if (parts.parts[i].document == NULL)
+                        failed = true;
+        struct nmc_document *document = parts.parts[0].document;
+        if (!failed) {
+                struct nmc_node *last = last_child(document->root);
+                for (size_t i = 1; i < parts.n; i++) {
+                        struct nmc_document *part = parts.parts[i].document;
+                        last->next = ((struct nmc_parent_node *)part->root)->children;
+                        last = last_child(part->root);
+                        nmc_arena_adopt(document->arena, part->arena);
+                }
+                *errors = NULL;
+        } else {
+                for (size_t i = 0; i < parts.n; i++) {
+                        nmc_document_free(parts.parts[i].document);
+                        nmc_parser_error_free(parts.parts[i].errors);
+                }
+                document = nmc_parse_n(context, input, length, flags, errors);
+        }
+        pthread_mutex_destroy(&parts.mutex);
+        free(parts.parts);
+        return document;
+}
+#else
+struct nmc_document *
+nmc_parse_parallel(const struct nmc_context *context, const char *input,
+                   size_t length, unsigned int flags, UNUSED(size_t threads),
+                   struct nmc_parser_error **errors)
+{
+        return nmc_parse_n(context, input, length, flags, errors);
+}
+#endif
+
+// NOTE A push parser keeps all the input it has been fed, as the tree
+// references it until it’s copied into text nodes, and locations are
+// only worked out from it when needed.  When it has to grow, the old
+// buffer is kept as well, as tokens already lexed point into it.
+struct nmc_parser {
+        struct parser parser;
+        struct nmc_document *document;
+        nmc_grammar_pstate *state;
+        int status;
+        char *input;
+        size_t length;
+        size_t size;
+};
+
+#define PUSH_INPUT_SIZE 4096
+
+// NOTE The input starts out empty, so parser_init() reads none of it, but
+// GCC can’t tell and warns that it may be read uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+struct nmc_parser *
+nmc_parser_new(const struct nmc_context *context, unsigned int flags)
+{
+        struct nmc_parser *parser = malloc(sizeof(*parser));
+        if (parser == NULL)
                 return NULL;
-        case NMC_NODE_ANCHOR: {
-                if (parser != NULL) {
-                        struct anchor *p = NULL;
-                        list_for_each_safe(struct anchor, c, n, parser->anchors) {
-                                if (c->node == (struct anchor_node *)node) {
-                                        if (p == NULL)
-                                                parser->anchors = n;
-                                        else
-                                                p->next = n;
-                                        break;
-                                }
-                                p = c;
+        parser->input = malloc(PUSH_INPUT_SIZE);
+        parser->state = parser->input == NULL ? NULL : nmc_grammar_pstate_new();
+        parser->document = parser->state == NULL ? NULL :
+                parser_init(&parser->parser, context, parser->input, 0,
+                            flags & ~NMC_PARSE_REFERENCE_INPUT);
+        if (parser->document == NULL) {
+                if (parser->state != NULL)
+                        nmc_grammar_pstate_delete(parser->state);
+                free(parser->input);
+                free(parser);
+                return NULL;
+        }
+        parser->parser.more = true;
+        parser->status = YYPUSH_MORE;
+        parser->length = 0;
+        parser->size = PUSH_INPUT_SIZE;
+        return parser;
+}
+#pragma GCC diagnostic pop
+
+// NOTE What parser_lex() changes in the parser, and where the arena was,
+// so that what it allocated for a token that is lexed again is released.
+struct lexer {
+        const char *p;
+        const char *first;
+        size_t indent;
+        size_t dedents;
+        bool bol;
+        int want;
+        struct nmc_parser_error *last;
+        struct nmc_arena_mark mark;
+};
+
+static inline struct lexer
+lexer_save(const struct parser *parser)
+{
+        return (struct lexer){
+                parser->p, parser->first, parser->indent, parser->dedents,
+                parser->bol, parser->want, parser->errors.last,
+                nmc_arena_mark(parser->arena)
+        };
+}
+
+static void
+lexer_restore(struct parser *parser, const struct lexer *lexer)
+{
+        parser->p = lexer->p;
+        parser->first = lexer->first;
+        parser->indent = lexer->indent;
+        parser->dedents = lexer->dedents;
+        parser->bol = lexer->bol;
+        parser->want = lexer->want;
+        nmc_arena_release(parser->arena,
+                          parser->resume.p != NULL &&
+                          parser->resume.type == CODEBLOCK ?
+                          parser->resume.mark : lexer->mark);
+        if (parser->errors.last == lexer->last)
+                return;
+        if (lexer->last == NULL) {
+                nmc_parser_error_free(parser->errors.first);
+                parser->errors.first = NULL;
+        } else {
+                nmc_parser_error_free(lexer->last->next);
+                lexer->last->next = NULL;
+        }
+        parser->errors.last = lexer->last;
+}
+
+// NOTE Rather than suspend the lexer in the middle of a token, which may
+// be anywhere in a character or in the lookahead across lines that eol(),
+// text(), and codeblock() do, a token that reached the end of the input
+// before more may follow is thrown away and lexed again once there is.
+// Most tokens are short and are lexed again from the start, but code
+// blocks and the text of footnotes may be megabytes long, so they resume
+// at the last line that they had seen all of, or lexing them would take
+// time quadratic in their length.  Only the token being lexed is lexed
+// again, as those already pushed to the grammar were complete.
+static void
+parser_push(struct nmc_parser *parser)
+{
+        struct parser *p = &parser->parser;
+        while (parser->status == YYPUSH_MORE) {
+                YYSTYPE value;
+                YYLTYPE location;
+                int token;
+                do {
+                        struct lexer lexer = lexer_save(p);
+                        p->starved = false;
+                        token = parser_lex(p, &location, &value);
+                        if (p->starved && p->more && !parser_is_oom(p)) {
+                                lexer_restore(p, &lexer);
+                                return;
                         }
-                }
-                anchor_free1(((struct anchor_node *)node)->u.anchor);
-                return parent_node_free((struct nmc_parent_node *)node, parser);
+                        p->resume.p = NULL;
+                } while (token == AGAIN);
+                parser->status = nmc_grammar_push_parse(parser->state, token,
+                                                        &value, &location, p);
         }
-        default:
-                assert(false);
+}
+
+static bool
+parser_grow(struct nmc_parser *parser, size_t length)
+{
+        struct parser *p = &parser->parser;
+        size_t size = parser->size;
+        while (size - parser->length < length)
+                if ((size *= 2) <= parser->size)
+                        return false;
+        char *input = malloc(size);
+        struct moved *moved = input == NULL ? NULL : malloc(sizeof(*moved));
+        if (moved == NULL) {
+                free(input);
+                return false;
         }
+        memcpy(input, parser->input, parser->length);
+        *moved = (struct moved){ p->moved, parser->input, p->end, false };
+        p->moved = moved;
+        p->p = input + (p->p - p->input);
+        p->first = input + (p->first - p->input);
+        if (p->resume.p != NULL) {
+                p->resume.p = input + (p->resume.p - p->input);
+                p->resume.begin = input + (p->resume.begin - p->input);
+                p->resume.end = input + (p->resume.end - p->input);
+        }
+        p->input = parser->input = input;
+        parser->size = size;
+        return true;
 }
 
+bool
+nmc_parser_feed(struct nmc_parser *parser, const char *chunk, size_t length)
+{
+        if (parser->status != YYPUSH_MORE)
+                return false;
+        if (length == 0)
+                return true;
+        struct parser *p = &parser->parser;
+        if (parser->size - parser->length < length && !parser_grow(parser, length)) {
+                parser_oom(p);
+                // NOTE As when Bison runs out of memory.
+                parser->status = 2;
+                return false;
+        }
+        memcpy(parser->input + parser->length, chunk, length);
+        parser->length += length;
+        p->end = p->input + parser->length;
+        // NOTE The lines index only covers the input as it was when built.
+        free(p->lines.begins);
+        p->lines = (struct lines){ NULL, 0 };
+        structure_extend(&p->structure, p->input, p->end);
+        parser_push(parser);
+        return parser->status == YYPUSH_MORE;
+}
+
+struct nmc_document *
+nmc_parser_finish(struct nmc_parser *parser, struct nmc_parser_error **errors)
+{
+        parser->parser.more = false;
+        parser_push(parser);
+        nmc_grammar_pstate_delete(parser->state);
+        free_moved(&parser->parser);
+        list_for_each_safe(struct moved, m, n, parser->parser.moved)
+                free(m);
+        free(parser->input);
+        struct nmc_document *document = parser_finish(&parser->parser,
+                                                      parser->document,
+                                                      errors);
+        free(parser);
+        return document;
+}
+
+// NOTE An incremental parser keeps its text split at top-level sections
+// into regions of about INCREMENTAL_REGION_SIZE bytes, each parsed into a
+// document of its own, as nmc_parse_parallel() parses its parts, and links
+// their top-level nodes into one list under a document node of its own.
+// An edit reparses the regions that it touches, which include those on
+// either side of it, so that sections that it joins or splits are too.
+// Nothing else reaches across a top-level section, as it isn’t indented
+// and footnotes and their anchors are in the same block.  Should that
+// fail, the whole text is parsed at once, to report the same errors as
+// nmc_parse_n() would.
+#define INCREMENTAL_REGION_SIZE (32 * 1024)
+
+struct region {
+        size_t offset;
+        size_t length;
+        struct nmc_document *document;
+        struct nmc_node *first;
+        struct nmc_node *last;
+};
+
+struct nmc_incremental {
+        const struct nmc_context *context;
+        unsigned int flags;
+        char *input;
+        size_t length;
+        size_t size;
+        struct region *regions;
+        size_t n;
+        size_t allocated;
+        struct nmc_parent_node root;
+};
+
+struct nmc_incremental *
+nmc_incremental_new(const struct nmc_context *context, unsigned int flags)
+{
+        struct nmc_incremental *incremental = malloc(sizeof(*incremental));
+        if (incremental == NULL)
+                return NULL;
+        incremental->context = context;
+        incremental->flags = flags & ~NMC_PARSE_REFERENCE_INPUT;
+        incremental->input = NULL;
+        incremental->length = 0;
+        incremental->size = 0;
+        incremental->regions = NULL;
+        incremental->n = 0;
+        incremental->allocated = 0;
+        incremental->root = (struct nmc_parent_node){
+                { NULL, NMC_NODE_TYPE_PARENT, NMC_NODE_DOCUMENT }, NULL
+        };
+        return incremental;
+}
+
+static bool
+incremental_input_reserve(struct nmc_incremental *incremental, size_t n)
+{
+        if (incremental->input != NULL && n <= incremental->size)
+                return true;
+        size_t size = incremental->size == 0 ? PUSH_INPUT_SIZE :
+                incremental->size;
+        while (size < n)
+                size *= 2;
+        char *input = realloc(incremental->input, size);
+        if (input == NULL)
+                return false;
+        incremental->input = input;
+        incremental->size = size;
+        return true;
+}
+
+// NOTE There must be room for the text as edited.
 static void
-nmc_node_unlink_and_free(struct nmc_node *node, struct parser *parser)
-{
-        typedef struct nmc_node *(*nodefreefn)(struct nmc_node *, struct parser *);
-        static nodefreefn fns[] = {
-                [NMC_NODE_TYPE_PARENT] = (nodefreefn)parent_node_free,
-                [NMC_NODE_TYPE_DATA] = (nodefreefn)data_node_free,
-                [NMC_NODE_TYPE_TEXT] = (nodefreefn)text_node_free,
-                [NMC_NODE_TYPE_PRIVATE] = private_node_free,
+incremental_input_edit(struct nmc_incremental *incremental, size_t offset,
+                       size_t removed, const char *inserted, size_t length)
+{
+        memmove(incremental->input + offset + length,
+                incremental->input + offset + removed,
+                incremental->length - offset - removed);
+        if (length > 0)
+                memcpy(incremental->input + offset, inserted, length);
+        incremental->length = incremental->length - removed + length;
+}
+
+// NOTE Returns the last region that begins at or before offset.
+static PURE size_t
+incremental_find(const struct nmc_incremental *incremental, size_t offset)
+{
+        size_t i = 0, j = incremental->n;
+        while (j - i > 1) {
+                size_t m = i + (j - i) / 2;
+                if (incremental->regions[m].offset <= offset)
+                        i = m;
+                else
+                        j = m;
+        }
+        return i;
+}
+
+// NOTE The parser reports running out of memory as it does any other
+// error, but always last, unless it couldn’t even start.
+static PURE bool
+errors_oom(struct nmc_parser_error *errors)
+{
+        bool oom = false;
+        list_for_each(struct nmc_parser_error, p, errors)
+                oom = p == &nmc_parser_oom_error ||
+                        strcmp(p->message, nmc_parser_oom_error.message) == 0;
+        return oom;
+}
+
+// NOTE The first region is parsed as a document, the rest as top-level
+// sections.
+static bool
+region_parse(struct nmc_incremental *incremental, struct region *region,
+             size_t offset, size_t length, struct nmc_parser_error **errors)
+{
+        const char *input = incremental->input + offset;
+        struct nmc_document *document =
+                offset == 0 ?
+                nmc_parse_n(incremental->context, input, length,
+                            incremental->flags, errors) :
+                parse_sections(incremental->context, input, length,
+                               incremental->flags, errors);
+        if (document == NULL)
+                return false;
+        *region = (struct region){
+                offset, length, document,
+                ((struct nmc_parent_node *)document->root)->children,
+                last_child(document->root)
         };
+        return true;
+}
 
-        if (node == NULL)
-                return;
-        struct nmc_node *p = node;
-        struct nmc_node *last = p;
-        while (last->next != NULL)
-                last = last->next;
-        while (p != NULL) {
-                struct nmc_node *children = fns[p->type](p, parser);
-                if (children != NULL) {
-                        last->next = children;
-                        while (last->next != NULL)
-                                last = last->next;
+static size_t
+regions_max(size_t length)
+{
+        return length / INCREMENTAL_REGION_SIZE + 1;
+}
+
+// NOTE Parses the text from start up to end into regions, returning how
+// many there are, or 0 if any of them fails, in which case oom is set if
+// it failed for want of memory.
+static size_t
+regions_parse(struct nmc_incremental *incremental, struct region *regions,
+              size_t start, size_t end, bool *oom)
+{
+        const char *input = incremental->input;
+        size_t n = 0;
+        size_t p = start;
+        do {
+                size_t q = end;
+                if (end - p > INCREMENTAL_REGION_SIZE)
+                        q = next_section(input,
+                                         input + p + INCREMENTAL_REGION_SIZE - 1,
+                                         input + end) - input;
+                struct nmc_parser_error *errors;
+                if (!region_parse(incremental, &regions[n], p, q - p,
+                                  &errors)) {
+                        *oom = errors_oom(errors);
+                        nmc_parser_error_free(errors);
+                        for (size_t i = 0; i < n; i++)
+                                nmc_document_free(regions[i].document);
+                        return 0;
                 }
-                struct nmc_node *next = p->next;
-                free(p);
-                p = next;
+                n++;
+                p = q;
+        } while (p < end);
+        return n;
+}
+
+static bool
+regions_reserve(struct nmc_incremental *incremental, size_t n)
+{
+        if (n <= incremental->allocated)
+                return true;
+        size_t allocated = incremental->allocated == 0 ? 16 :
+                incremental->allocated;
+        while (allocated < n)
+                allocated *= 2;
+        struct region *regions = realloc(incremental->regions,
+                                         allocated * sizeof(*regions));
+        if (regions == NULL)
+                return false;
+        incremental->regions = regions;
+        incremental->allocated = allocated;
+        return true;
+}
+
+// NOTE Links the top-level nodes of the regions from the one before i up
+// to the first one at or after j that has any.
+static void
+regions_link(struct nmc_incremental *incremental, size_t i, size_t j)
+{
+        struct region *regions = incremental->regions;
+        while (i > 0 && regions[i - 1].last == NULL)
+                i--;
+        struct nmc_node **next = i > 0 ? &regions[i - 1].last->next :
+                &incremental->root.children;
+        for (; i < incremental->n; i++) {
+                if (regions[i].first == NULL)
+                        continue;
+                *next = regions[i].first;
+                if (i >= j)
+                        return;
+                next = &regions[i].last->next;
         }
+        *next = NULL;
+}
+
+// NOTE Replaces regions a up to b with the n regions given, moving those
+// after them by delta bytes.  There must be room for them.
+static void
+regions_splice(struct nmc_incremental *incremental, size_t a, size_t b,
+               const struct region *regions, size_t n, ptrdiff_t delta)
+{
+        struct region *r = incremental->regions;
+        for (size_t i = a; i < b; i++)
+                nmc_document_free(r[i].document);
+        memmove(r + a + n, r + b, (incremental->n - b) * sizeof(*r));
+        incremental->n = incremental->n - (b - a) + n;
+        for (size_t i = a + n; i < incremental->n; i++)
+                r[i].offset += delta;
+        memcpy(r + a, regions, n * sizeof(*r));
+        regions_link(incremental, a, a + n);
+}
+
+// NOTE All that the edit needs memory for is allocated before the text is
+// edited, and what it removes is kept, so that if there isn’t memory
+// enough to parse the text as edited, the edit can be undone.  Parsing
+// only falls back to the whole text for errors in it.
+struct nmc_node *
+nmc_incremental_edit(struct nmc_incremental *incremental, size_t offset,
+                     size_t removed, const char *inserted, size_t length,
+                     struct nmc_parser_error **errors)
+{
+        size_t n = incremental->n;
+        size_t a = 0, b = n;
+        if (n > 0) {
+                a = incremental_find(incremental, offset > 0 ? offset - 1 : 0);
+                b = incremental_find(incremental, offset + removed) + 1;
+        }
+        // NOTE The regions reparsed begin at start and end at the end of the
+        // text at the latest.
+        size_t start = a < n ? incremental->regions[a].offset : 0;
+        size_t m = regions_max(incremental->length - removed + length - start);
+        struct region *regions = malloc(m * sizeof(*regions));
+        char *saved = removed > 0 ? malloc(removed) : NULL;
+        if (regions == NULL || (removed > 0 && saved == NULL) ||
+            !regions_reserve(incremental, n + m) ||
+            !incremental_input_reserve(incremental, incremental->length -
+                                       removed + length)) {
+                free(saved);
+                free(regions);
+                *errors = &nmc_parser_oom_error;
+                return NULL;
+        }
+        if (removed > 0)
+                memcpy(saved, incremental->input + offset, removed);
+        incremental_input_edit(incremental, offset, removed, inserted, length);
+        ptrdiff_t delta = (ptrdiff_t)length - (ptrdiff_t)removed;
+        struct region *r = incremental->regions;
+        size_t end = b < n ? r[b].offset + delta : incremental->length;
+        // NOTE The edit may have left something before the next region
+        // that takes in the newline before it.
+        while (b < n && !ends_line(incremental->input,
+                                   incremental->input + end - 1)) {
+                b++;
+                end = b < n ? r[b].offset + delta : incremental->length;
+        }
+        bool oom = false;
+        struct region region;
+        if ((m = regions_parse(incremental, regions, start, end, &oom)) > 0) {
+                regions_splice(incremental, a, b, regions, m, delta);
+                *errors = NULL;
+        } else if (!oom && region_parse(incremental, &region, 0,
+                                        incremental->length, errors)) {
+                regions_splice(incremental, 0, n, &region, 1, 0);
+                *errors = NULL;
+        } else if (!oom && !errors_oom(*errors)) {
+                for (size_t i = 0; i < n; i++)
+                        nmc_document_free(r[i].document);
+                incremental->n = 0;
+                incremental->root.children = NULL;
+        } else {
+                if (!oom)
+                        nmc_parser_error_free(*errors);
+                incremental_input_edit(incremental, offset, length, saved,
+                                       removed);
+                *errors = &nmc_parser_oom_error;
+        }
+        free(saved);
+        free(regions);
+        return *errors == NULL ? &incremental->root.node : NULL;
 }
 
 void
-nmc_node_free(struct nmc_node *node)
+nmc_incremental_free(struct nmc_incremental *incremental)
+{
+        if (incremental == NULL)
+                return;
+        for (size_t i = 0; i < incremental->n; i++)
+                nmc_document_free(incremental->regions[i].document);
+        free(incremental->regions);
+        free(incremental->input);
+        free(incremental);
+}
+
+struct nmc_document *
+nmc_parse(const struct nmc_context *context, const char *input,
+          unsigned int flags, struct nmc_parser_error **errors)
 {
-        nmc_node_unlink_and_free(node, NULL);
+        return nmc_parse_n(context, input, strlen(input), flags, errors);
+}
+
+void
+nmc_document_free(struct nmc_document *document)
+{
+        if (document != NULL)
+                nmc_arena_free(document->arena);
+}
+
+bool
+nmc_context_init(struct nmc_context *context, unsigned int flags,
+                 UNUSED(struct nmc_error *error))
+{
+        context->flags = flags;
+        return true;
+}
+
+void
+nmc_context_release(UNUSED(struct nmc_context *context))
+{
+}
+
+char *
+nmc_location_str(const struct nmc_location *l)
+{
+        char *s;
+        if (l->first_line == l->last_line) {
+                if (l->first_column == l->last_column)
+                        asprintf(&s, "%d:%d", l->first_line, l->first_column);
+                else
+                        asprintf(&s, "%d.%d-%d", l->first_line, l->first_column, l->last_column);
+        } else
+                asprintf(&s, "%d.%d-%d.%d", l->first_line, l->first_column, l->last_line, l->last_column);
+        return s;
 }
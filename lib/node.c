@@ -6,16 +6,23 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
+#include <time.h>
 #include <unistd.h>
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
 
 #include <nmc.h>
 #include <nmc/list.h>
 
 #include <private.h>
 
-#include "error.h"
+#include <buffer.h>
 
-#define NODE_IS_NESTED(n) ((n)->name < NMC_NODE_TEXT)
+#include "error.h"
+#include "escape.h"
+#include "node.h"
 
 CONST bool
 nmc_node_traverse_null(UNUSED(struct nmc_node *node), UNUSED(void *closure))
@@ -120,16 +127,16 @@ nmc_node_traverse_r(struct nmc_node *node, nmc_node_traverse_fn enter,
 }
 
 struct xml_closure {
+        const struct nmc_context *context;
         struct nmc_output *output;
         size_t indent;
         struct nmc_error *error;
 };
 
-static inline bool
+static bool
 outs(struct xml_closure *closure, const char *string, size_t length)
 {
-        size_t w;
-        return nmc_output_write_all(closure->output, string, length, &w, closure->error);
+        return nmc_output_write(closure->output, string, length, closure->error);
 }
 
 static inline bool
@@ -145,9 +152,10 @@ indent(struct xml_closure *closure, size_t n)
 {
         if (!outc(closure, '\n'))
                 return false;
-        static char cs[2 * MAX_INDENT];
-        if (cs[0] == '\0')
-                memset(cs, ' ', 2 * MAX_INDENT);
+#define SPACES "                "
+        static const char cs[2 * MAX_INDENT + 1] =
+                SPACES SPACES SPACES SPACES SPACES SPACES SPACES SPACES;
+#undef SPACES
         while (n > 0) {
                 size_t i = n > MAX_INDENT ? MAX_INDENT : n;
                 if (!outs(closure, cs, 2 * i))
@@ -180,24 +188,21 @@ static const struct entity attribute_entities[] = {
 #undef N
 #undef E
 
-static PURE bool
-escape(struct xml_closure *closure, const char *string, size_t n_entities,
-       const struct entity *entities)
+static bool
+escape(struct xml_closure *closure, const char *string, size_t length,
+       bool attribute)
 {
+        const struct entity *entities = attribute ? attribute_entities : text_entities;
         const char *s = string;
-        const char *e = s;
-        while (*e != '\0') {
-                const struct entity *p;
-                if ((unsigned char)*e < n_entities &&
-                    (p = &entities[(unsigned char)*e])->n > 0) {
-                        if (!(outs(closure, s, e - s) &&
-                              outs(closure, p->s, p->n)))
-                                return false;
-                        s = e + 1;
-                }
-                e++;
+        const char *end = s + length;
+        const char *e;
+        while ((e = escape_find(s, end, attribute)) < end) {
+                const struct entity *p = &entities[(unsigned char)*e];
+                if (!(outs(closure, s, e - s) && outs(closure, p->s, p->n)))
+                        return false;
+                s = e + 1;
         }
-        return outs(closure, s, e - s);
+        return outs(closure, s, end - s);
 }
 
 static bool
@@ -215,8 +220,10 @@ element_end(struct xml_closure *closure, const char *name, size_t n)
 static bool
 text_enter(struct nmc_node *node, struct xml_closure *closure)
 {
-        return escape(closure, ((struct nmc_text_node *)node)->text,
-                      lengthof(text_entities), text_entities);
+        list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text)
+                if (!escape(closure, p->string, p->length, false))
+                        return false;
+        return true;
 }
 
 static bool block_enter(struct nmc_node *node, struct xml_closure *closure);
@@ -259,11 +266,53 @@ static bool inline_enter(struct nmc_node *node, struct xml_closure *closure);
 
 typedef bool (*xmltraversefn)(struct nmc_node *, struct xml_closure *);
 
+struct html_closure;
+
+typedef bool (*htmltraversefn)(struct nmc_node *, struct html_closure *);
+
+static bool html_document_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_document_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_title_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_title_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_section_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_text_block_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_indenting_block_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_indenting_block_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_paragraph_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_paragraph_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_item_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_item_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_quote_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_quote_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_line_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_line_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_attribution_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_attribution_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_codeblock_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_codeblock_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_table_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_table_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_cell_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_cell_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_figure_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_figure_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_image_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_inline_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_abbreviation_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_link_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_link_leave(struct nmc_node *node, struct html_closure *closure);
+static bool html_text_enter(struct nmc_node *node, struct html_closure *closure);
+static bool html_leave(struct nmc_node *node, struct html_closure *closure);
+
 static struct {
         const char *name;
         size_t length;
         xmltraversefn enter;
         xmltraversefn leave;
+        const char *html;
+        size_t html_length;
+        htmltraversefn html_enter;
+        htmltraversefn html_leave;
 } names[] = {
 #define indenting_block indenting_block_enter, indenting_block_leave
 #define text_block text_block_enter, leave
@@ -271,37 +320,46 @@ static struct {
 #define nline inline_enter, leave
 #define data (xmltraversefn)data_enter, leave
 #define data_block (xmltraversefn)data_block_enter, leave
+#define html_indenting_block html_indenting_block_enter, html_indenting_block_leave
+#define html_text_block html_text_block_enter, html_leave
+#define html_inline html_inline_enter, html_leave
+#define HTML(kind) html_##kind##_enter, html_##kind##_leave
 #define NAME(n) n, sizeof(n) - 1
-        [NMC_NODE_DOCUMENT] = { NAME("nml"), indenting_block },
-        [NMC_NODE_TITLE] = { NAME("title"), block },
-        [NMC_NODE_SECTION] = { NAME("section"), indenting_block },
-        [NMC_NODE_PARAGRAPH] = { NAME("p"), block },
-        [NMC_NODE_ITEMIZATION] = { NAME("itemization"), indenting_block },
-        [NMC_NODE_ENUMERATION] = { NAME("enumeration"), indenting_block },
-        [NMC_NODE_ITEM] = { NAME("item"), indenting_block },
-        [NMC_NODE_DEFINITIONS] = { NAME("definitions"), indenting_block },
-        [NMC_NODE_TERM] = { NAME("term"), text_block },
-        [NMC_NODE_DEFINITION] = { NAME("definition"), indenting_block },
-        [NMC_NODE_QUOTE] = { NAME("quote"), indenting_block },
-        [NMC_NODE_LINE] = { NAME("line"), block },
-        [NMC_NODE_ATTRIBUTION] = { NAME("attribution"), block },
-        [NMC_NODE_CODEBLOCK] = { NAME("code"), text_block },
-        [NMC_NODE_TABLE] = { NAME("table"), indenting_block },
-        [NMC_NODE_HEAD] = { NAME("head"), indenting_block },
-        [NMC_NODE_BODY] = { NAME("body"), indenting_block },
-        [NMC_NODE_ROW] = { NAME("row"), indenting_block },
-        [NMC_NODE_CELL] = { NAME("cell"), block },
-        [NMC_NODE_FIGURE] = { NAME("figure"), indenting_block },
-        [NMC_NODE_IMAGE] = { NAME("image"), data_block },
-        [NMC_NODE_CODE] = { NAME("code"), nline },
-        [NMC_NODE_EMPHASIS] = { NAME("emphasis"), nline },
-        [NMC_NODE_GROUP] = { NULL, 0, (xmltraversefn)nmc_node_traverse_null, (xmltraversefn)nmc_node_traverse_null },
-        [NMC_NODE_ABBREVIATION] = { NAME("abbreviation"), data },
-        [NMC_NODE_LINK] = { NAME("link"), data },
-        [NMC_NODE_TEXT] = { NULL, 0, text_enter, NULL },
-        [NMC_NODE_BUFFER] = { NAME("buffer"), NULL, NULL },
-        [NMC_NODE_ANCHOR] = { NAME("anchor"), NULL, NULL },
+        [NMC_NODE_DOCUMENT] = { NAME("nml"), indenting_block, NULL, 0, HTML(document) },
+        [NMC_NODE_TITLE] = { NAME("title"), block, NAME("h1"), HTML(title) },
+        [NMC_NODE_SECTION] = { NAME("section"), indenting_block, NAME("section"), html_section_enter, html_indenting_block_leave },
+        [NMC_NODE_PARAGRAPH] = { NAME("p"), block, NAME("p"), HTML(paragraph) },
+        [NMC_NODE_ITEMIZATION] = { NAME("itemization"), indenting_block, NAME("ul"), html_indenting_block },
+        [NMC_NODE_ENUMERATION] = { NAME("enumeration"), indenting_block, NAME("ol"), html_indenting_block },
+        [NMC_NODE_ITEM] = { NAME("item"), indenting_block, NAME("li"), HTML(item) },
+        [NMC_NODE_DEFINITIONS] = { NAME("definitions"), indenting_block, NAME("dl"), html_indenting_block },
+        [NMC_NODE_TERM] = { NAME("term"), text_block, NAME("dt"), html_text_block },
+        [NMC_NODE_DEFINITION] = { NAME("definition"), indenting_block, NAME("dd"), html_indenting_block },
+        [NMC_NODE_QUOTE] = { NAME("quote"), indenting_block, NAME("blockquote"), HTML(quote) },
+        [NMC_NODE_LINE] = { NAME("line"), block, NAME("br"), HTML(line) },
+        [NMC_NODE_ATTRIBUTION] = { NAME("attribution"), block, NAME("div"), HTML(attribution) },
+        [NMC_NODE_CODEBLOCK] = { NAME("code"), text_block, NAME("code"), HTML(codeblock) },
+        [NMC_NODE_TABLE] = { NAME("table"), indenting_block, NAME("table"), HTML(table) },
+        [NMC_NODE_HEAD] = { NAME("head"), indenting_block, NAME("thead"), html_indenting_block },
+        [NMC_NODE_BODY] = { NAME("body"), indenting_block, NAME("tbody"), html_indenting_block },
+        [NMC_NODE_ROW] = { NAME("row"), indenting_block, NAME("tr"), html_indenting_block },
+        [NMC_NODE_CELL] = { NAME("cell"), block, NAME("td"), HTML(cell) },
+        [NMC_NODE_FIGURE] = { NAME("figure"), indenting_block, NAME("figure"), HTML(figure) },
+        [NMC_NODE_IMAGE] = { NAME("image"), data_block, NAME("img"), html_image_enter, NULL },
+        [NMC_NODE_CODE] = { NAME("code"), nline, NAME("code"), html_inline },
+        [NMC_NODE_EMPHASIS] = { NAME("emphasis"), nline, NAME("em"), html_inline },
+        [NMC_NODE_GROUP] = { NULL, 0, (xmltraversefn)nmc_node_traverse_null, (xmltraversefn)nmc_node_traverse_null,
+                             NULL, 0, (htmltraversefn)nmc_node_traverse_null, (htmltraversefn)nmc_node_traverse_null },
+        [NMC_NODE_ABBREVIATION] = { NAME("abbreviation"), data, NAME("abbr"), html_abbreviation_enter, html_leave },
+        [NMC_NODE_LINK] = { NAME("link"), data, NAME("a"), HTML(link) },
+        [NMC_NODE_TEXT] = { NULL, 0, text_enter, NULL, NULL, 0, html_text_enter, NULL },
+        [NMC_NODE_BUFFER] = { NAME("buffer"), NULL, NULL, NULL, 0, NULL, NULL },
+        [NMC_NODE_ANCHOR] = { NAME("anchor"), NULL, NULL, NULL, 0, NULL, NULL },
 #undef NAME
+#undef HTML
+#undef html_inline
+#undef html_text_block
+#undef html_indenting_block
 #undef indenting_block
 #undef text_block
 #undef block
@@ -324,8 +382,7 @@ outattributes(struct xml_closure *closure, struct nmc_node_datum *data)
                 if (!(outc(closure, ' ') &&
                       outs(closure, p->name, strlen(p->name)) &&
                       outs(closure, "=\"", 2) &&
-                      escape(closure, p->value,
-                             lengthof(attribute_entities), attribute_entities) &&
+                      escape(closure, p->value, strlen(p->value), true) &&
                       outc(closure, '"')))
                         return false;
         }
@@ -338,7 +395,7 @@ data_enter(struct nmc_data_node *node, struct xml_closure *closure)
         return outc(closure, '<') &&
                 outs(closure, names[node->node.node.name].name,
                      names[node->node.node.name].length) &&
-                outattributes(closure, node->data->data) &&
+                outattributes(closure, node->data) &&
                 outc(closure, '>');
 }
 
@@ -369,11 +426,13 @@ xml_leave(struct nmc_node *node, struct xml_closure *closure)
         return names[node->name].leave(node, closure);
 }
 
+static const char xml_header[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>";
+
 bool
-nmc_node_xml(struct nmc_node *node, struct nmc_output *output, struct nmc_error *error)
+nmc_node_xml(const struct nmc_context *context, struct nmc_node *node,
+             struct nmc_output *output, struct nmc_error *error)
 {
-        struct xml_closure closure = { output, 0, error };
-        static char xml_header[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>";
+        struct xml_closure closure = { context, output, 0, error };
         return outs(&closure, xml_header, sizeof(xml_header) - 1) &&
                 nmc_node_traverse(node, (nmc_node_traverse_fn)xml_enter,
                                   (nmc_node_traverse_fn)xml_leave, &closure,
@@ -381,6 +440,1850 @@ nmc_node_xml(struct nmc_node *node, struct nmc_output *output, struct nmc_error
                 outc(&closure, '\n');
 }
 
+bool
+xml_document_begin(const struct nmc_context *context,
+                   struct nmc_node *children, struct nmc_output *output,
+                   struct nmc_error *error)
+{
+        struct xml_closure closure = { context, output, 0, error };
+        struct nmc_node document = { NULL, NMC_NODE_TYPE_PARENT, NMC_NODE_DOCUMENT };
+        return outs(&closure, xml_header, sizeof(xml_header) - 1) &&
+                xml_enter(&document, &closure) &&
+                nmc_node_traverse(children, (nmc_node_traverse_fn)xml_enter,
+                                  (nmc_node_traverse_fn)xml_leave, &closure,
+                                  error);
+}
+
+bool
+xml_document_section(const struct nmc_context *context,
+                     struct nmc_node *section, struct nmc_output *output,
+                     struct nmc_error *error)
+{
+        struct xml_closure closure = { context, output, 1, error };
+        return nmc_node_traverse(section, (nmc_node_traverse_fn)xml_enter,
+                                 (nmc_node_traverse_fn)xml_leave, &closure,
+                                 error);
+}
+
+bool
+xml_document_end(const struct nmc_context *context, struct nmc_output *output,
+                 struct nmc_error *error)
+{
+        struct xml_closure closure = { context, output, 1, error };
+        struct nmc_node document = { NULL, NMC_NODE_TYPE_PARENT, NMC_NODE_DOCUMENT };
+        return xml_leave(&document, &closure) && outc(&closure, '\n');
+}
+
+#ifdef HAVE_PTHREAD
+#define XML_BLOCK_SIZE (64 * 1024)
+
+// NOTE Keeps what’s written to it in a list of blocks, the last of which
+// is its buffer, so that output is copied once, into a block, and can then
+// be written with writev without being copied again.  Flushing the buffer
+// adds it to the list and starts a new one.  Writes too large for the
+// buffer get blocks of their own.
+struct blocks_output {
+        struct nmc_output output;
+        struct iovec *blocks;
+        size_t n;
+        size_t allocated;
+};
+
+static bool
+blocks_add(struct blocks_output *output, char *block, size_t length)
+{
+        if (output->n == output->allocated) {
+                size_t allocated = output->allocated == 0 ? 16 :
+                        2 * output->allocated;
+                struct iovec *blocks = realloc(output->blocks,
+                                               allocated * sizeof(*blocks));
+                if (blocks == NULL)
+                        return false;
+                output->blocks = blocks;
+                output->allocated = allocated;
+        }
+        output->blocks[output->n++] = (struct iovec){ block, length };
+        return true;
+}
+
+static ssize_t
+blocks_output_write(struct blocks_output *output, const char *string,
+                    size_t length, struct nmc_error *error)
+{
+        bool flushing = string == output->output.buffer;
+        char *block = malloc(flushing ? XML_BLOCK_SIZE : length);
+        if (block == NULL ||
+            !blocks_add(output, flushing ? output->output.buffer : block,
+                        length)) {
+                free(block);
+                nmc_error_oom(error);
+                return -1;
+        }
+        if (flushing)
+                output->output.buffer = block;
+        else
+                memcpy(block, string, length);
+        return length;
+}
+
+static bool
+blocks_output_init(struct blocks_output *output)
+{
+        nmc_output_init(&output->output,
+                        (nmc_output_write_fn)blocks_output_write, NULL);
+        output->output.buffer = malloc(XML_BLOCK_SIZE);
+        output->output.size = XML_BLOCK_SIZE;
+        output->blocks = NULL;
+        output->n = 0;
+        output->allocated = 0;
+        return output->output.buffer != NULL;
+}
+
+static void
+blocks_output_release(struct blocks_output *output)
+{
+        for (size_t i = 0; i < output->n; i++)
+                free(output->blocks[i].iov_base);
+        free(output->blocks);
+        free(output->output.buffer);
+}
+
+// NOTE A run of top-level nodes, from first up to, but not including, end,
+// serialized at the indent that they have in the document.
+struct xml_run {
+        struct nmc_node *first;
+        struct nmc_node *end;
+        struct blocks_output output;
+        struct nmc_error error;
+        bool r;
+};
+
+struct xml_runs {
+        const struct nmc_context *context;
+        struct xml_run *runs;
+        size_t n;
+        size_t next;
+        pthread_mutex_t mutex;
+};
+
+static bool
+xml_run(const struct nmc_context *context, struct xml_run *run)
+{
+        struct xml_closure closure = { context, &run->output.output, 1,
+                                       &run->error };
+        if (!blocks_output_init(&run->output))
+                return nmc_error_oom(&run->error);
+        for (struct nmc_node *p = run->first; p != run->end; p = p->next) {
+                if (!xml_enter(p, &closure))
+                        return false;
+                if (!NODE_IS_NESTED(p))
+                        continue;
+                if (NMC_NODE_HAS_CHILDREN(p) &&
+                    !nmc_node_traverse(nmc_node_children(p),
+                                       (nmc_node_traverse_fn)xml_enter,
+                                       (nmc_node_traverse_fn)xml_leave,
+                                       &closure, &run->error))
+                        return false;
+                if (!xml_leave(p, &closure))
+                        return false;
+        }
+        return nmc_output_flush(&run->output.output, &run->error);
+}
+
+static void *
+xml_runs_worker(void *closure)
+{
+        struct xml_runs *runs = closure;
+        pthread_mutex_lock(&runs->mutex);
+        while (runs->next < runs->n) {
+                size_t i = runs->next++;
+                pthread_mutex_unlock(&runs->mutex);
+                runs->runs[i].r = xml_run(runs->context, &runs->runs[i]);
+                pthread_mutex_lock(&runs->mutex);
+        }
+        pthread_mutex_unlock(&runs->mutex);
+        return NULL;
+}
+
+// NOTE Splits the n children of the document into runs of about n / m
+// siblings each and returns how many there are.
+static size_t
+xml_runs_split(struct xml_run *runs, size_t m, struct nmc_node *children,
+               size_t n)
+{
+        size_t k = 0;
+        struct nmc_node *p = children;
+        for (size_t i = 0; i < m && p != NULL; i++) {
+                runs[k].first = p;
+                for (size_t j = (i + 1) * n / m - i * n / m; j > 0; j--)
+                        p = p->next;
+                runs[k++].end = p;
+        }
+        return k;
+}
+
+#define XML_PARALLEL_MIN_CHILDREN 8
+
+// NOTE Each run of the document’s children is serialized on a thread of its
+// own into blocks of memory, which are then written to output in order,
+// with writev if output has it, so that the result is the same as that of
+// nmc_node_xml().  Memory use is thus that of the whole output.
+bool
+nmc_node_xml_parallel(const struct nmc_context *context, struct nmc_node *node,
+                      size_t threads, struct nmc_output *output,
+                      struct nmc_error *error)
+{
+        size_t n = 0;
+        if (threads >= 2 && node != NULL && node->name == NMC_NODE_DOCUMENT &&
+            node->next == NULL)
+                list_for_each(struct nmc_node, p, nmc_node_children(node))
+                        n++;
+        if (n < XML_PARALLEL_MIN_CHILDREN)
+                return nmc_node_xml(context, node, output, error);
+        // NOTE More runs than threads even out sections of different sizes.
+        size_t m = 4 * threads < n ? 4 * threads : n;
+        struct xml_runs runs = { context, calloc(m, sizeof(struct xml_run)),
+                                 0, 0, PTHREAD_MUTEX_INITIALIZER };
+        pthread_t *workers = malloc((threads - 1) * sizeof(pthread_t));
+        if (runs.runs == NULL || workers == NULL) {
+                free(workers);
+                free(runs.runs);
+                return nmc_node_xml(context, node, output, error);
+        }
+        runs.n = xml_runs_split(runs.runs, m, nmc_node_children(node), n);
+        size_t started = 0;
+        while (started < threads - 1 && started + 1 < runs.n &&
+               pthread_create(&workers[started], NULL, xml_runs_worker,
+                              &runs) == 0)
+                started++;
+        xml_runs_worker(&runs);
+        for (size_t i = 0; i < started; i++)
+                pthread_join(workers[i], NULL);
+        free(workers);
+
+        bool r = true;
+        size_t blocks = 0;
+        for (size_t i = 0; i < runs.n; i++) {
+                if (!runs.runs[i].r) {
+                        if (r)
+                                *error = runs.runs[i].error;
+                        else
+                                nmc_error_release(&runs.runs[i].error);
+                        r = false;
+                }
+                blocks += runs.runs[i].output.n;
+        }
+        struct iovec *iov = r ? malloc(blocks * sizeof(*iov)) : NULL;
+        if (r && iov == NULL)
+                r = nmc_error_oom(error);
+        if (r) {
+                struct iovec *p = iov;
+                for (size_t i = 0; i < runs.n; i++) {
+                        memcpy(p, runs.runs[i].output.blocks,
+                               runs.runs[i].output.n * sizeof(*p));
+                        p += runs.runs[i].output.n;
+                }
+                r = xml_document_begin(context, NULL, output, error) &&
+                        nmc_output_writev(output, iov, blocks, error) &&
+                        xml_document_end(context, output, error);
+        }
+        free(iov);
+        for (size_t i = 0; i < runs.n; i++)
+                blocks_output_release(&runs.runs[i].output);
+        pthread_mutex_destroy(&runs.mutex);
+        free(runs.runs);
+        return r;
+}
+#else
+bool
+nmc_node_xml_parallel(const struct nmc_context *context, struct nmc_node *node,
+                      UNUSED(size_t threads), struct nmc_output *output,
+                      struct nmc_error *error)
+{
+        return nmc_node_xml(context, node, output, error);
+}
+#endif
+
+bool
+nmc_flat_xml(const struct nmc_context *context,
+             const struct nmc_flat_document *document,
+             struct nmc_output *output, struct nmc_error *error)
+{
+        struct xml_closure closure = { context, output, 0, error };
+        return outs(&closure, xml_header, sizeof(xml_header) - 1) &&
+                nmc_flat_traverse(document, (nmc_node_traverse_fn)xml_enter,
+                                  (nmc_node_traverse_fn)xml_leave, &closure,
+                                  error) &&
+                outc(&closure, '\n');
+}
+
+// NOTE The HTML output matches what data/xsl/html.xsl produces from the
+// XML output when run through xsltproc, whitespace and all.  Indentation
+// thus follows the XML output, as the stylesheet copies it along, and
+// newlines are added where libxml2’s HTML serializer adds them.
+
+struct html_closure {
+        struct xml_closure xml;
+        struct nmc_node **parents;
+        size_t n;
+        size_t allocated;
+        size_t hoisting;
+        struct nmc_node *skip;
+        struct buffer scratch;
+};
+
+static inline struct nmc_node *
+html_ancestor(struct html_closure *closure, size_t i)
+{
+        return i < closure->n ? closure->parents[closure->n - 1 - i] : NULL;
+}
+
+static inline bool
+html_ancestor_is(struct html_closure *closure, size_t i, enum nmc_node_name name)
+{
+        struct nmc_node *p = html_ancestor(closure, i);
+        return p != NULL && p->name == name;
+}
+
+// NOTE html.xsl only turns quotes and code blocks into block-level
+// elements in these parents.
+static bool
+html_in_flow(struct html_closure *closure)
+{
+        struct nmc_node *p = html_ancestor(closure, 0);
+        if (p == NULL)
+                return false;
+        switch (p->name) {
+        case NMC_NODE_DOCUMENT:
+        case NMC_NODE_SECTION:
+        case NMC_NODE_ITEM:
+        case NMC_NODE_DEFINITION:
+                return true;
+        default:
+                return false;
+        }
+}
+
+static PURE const char *
+datum(struct nmc_node *node, const char *name)
+{
+        for (struct nmc_node_datum *p = ((struct nmc_data_node *)node)->data;
+             p->name != NULL; p++)
+                if (strcmp(p->name, name) == 0)
+                        return p->value;
+        return NULL;
+}
+
+static PURE bool
+html_is_figure_link(struct nmc_node *node)
+{
+        if (node->name != NMC_NODE_LINK)
+                return false;
+        const char *relation = datum(node, "relation");
+        return relation != NULL && strcmp(relation, "figure") == 0;
+}
+
+// NOTE Line endings in text are normalized as an XML parser would, with
+// *cr tracking a CR that ended the previous piece of text.
+static bool
+html_escape(struct html_closure *closure, const char *string, size_t length,
+            bool *cr)
+{
+        const char *s = string;
+        const char *end = s + length;
+        if (cr != NULL) {
+                if (*cr && s < end && *s == '\n')
+                        s++;
+                *cr = false;
+                const char *r;
+                while ((r = memchr(s, '\r', end - s)) != NULL) {
+                        if (!(escape(&closure->xml, s, r - s, false) &&
+                              outc(&closure->xml, '\n')))
+                                return false;
+                        s = r + 1;
+                        if (s == end)
+                                *cr = true;
+                        else if (*s == '\n')
+                                s++;
+                }
+        }
+        return escape(&closure->xml, s, end - s, false);
+}
+
+static bool
+html_text(struct html_closure *closure, struct nmc_node *node)
+{
+        bool cr = false;
+        list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text)
+                if (!html_escape(closure, p->string, p->length, &cr))
+                        return false;
+        return true;
+}
+
+static bool
+html_attribute(struct html_closure *closure, const char *name,
+               const char *value, size_t length)
+{
+        struct xml_closure *xml = &closure->xml;
+        bool apostrophe = memchr(value, '"', length) != NULL;
+        bool quot = apostrophe && memchr(value, '\'', length) != NULL;
+        char quote = apostrophe && !quot ? '\'' : '"';
+        if (!(outc(xml, ' ') && outs(xml, name, strlen(name)) &&
+              outc(xml, '=') && outc(xml, quote)))
+                return false;
+        const char *s = value;
+        const char *end = value + length;
+        const char *q;
+        if (quot)
+                while ((q = memchr(s, '"', end - s)) != NULL) {
+                        if (!(escape(xml, s, q - s, false) &&
+                              outs(xml, "&quot;", 6)))
+                                return false;
+                        s = q + 1;
+                }
+        return escape(xml, s, end - s, false) && outc(xml, quote);
+}
+
+static CONST bool
+is_uri_safe(unsigned char c)
+{
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+                ('0' <= c && c <= '9') ||
+                (c != '\0' && strchr("-_.!~*'()@/:=?;#%&,+", c) != NULL);
+}
+
+// NOTE libxml2 escapes URI attributes, after having escaped entities.
+static bool
+html_uri_attribute(struct html_closure *closure, const char *name,
+                   const char *value)
+{
+        static const char hex[] = "0123456789ABCDEF";
+        struct xml_closure *xml = &closure->xml;
+        if (value == NULL)
+                value = "";
+        while (*value == ' ' || *value == '\t' || *value == '\n' || *value == '\r')
+                value++;
+        if (!(outc(xml, ' ') && outs(xml, name, strlen(name)) &&
+              outs(xml, "=\"", 2)))
+                return false;
+        for (const unsigned char *p = (const unsigned char *)value; *p != '\0'; p++) {
+                bool r;
+                switch (*p) {
+                case '&': r = outs(xml, "&amp;", 5); break;
+                case '<': r = outs(xml, "&lt;", 4); break;
+                case '>': r = outs(xml, "&gt;", 4); break;
+                default:
+                        if (is_uri_safe(*p))
+                                r = outc(xml, (char)*p);
+                        else
+                                r = outs(xml, (char[]){ '%', hex[*p >> 4], hex[*p & 0xf] }, 3);
+                }
+                if (!r)
+                        return false;
+        }
+        return outc(xml, '"');
+}
+
+struct normalizer {
+        struct buffer *buffer;
+        bool started;
+        bool space;
+};
+
+// NOTE This is XPath’s normalize-space().
+static bool
+normalize(struct normalizer *normalizer, const char *string, size_t length)
+{
+        for (const char *s = string, *end = string + length; s < end; s++) {
+                if (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r') {
+                        normalizer->space = normalizer->started;
+                        continue;
+                }
+                if ((normalizer->space &&
+                     !buffer_append_c(normalizer->buffer, ' ', 1)) ||
+                    !buffer_append_c(normalizer->buffer, *s, 1))
+                        return false;
+                normalizer->started = true;
+                normalizer->space = false;
+        }
+        return true;
+}
+
+static bool
+normalize_enter(struct nmc_node *node, struct normalizer *normalizer)
+{
+        if (node->type == NMC_NODE_TYPE_TEXT)
+                list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text)
+                        if (!normalize(normalizer, p->string, p->length))
+                                return false;
+        return true;
+}
+
+static bool
+html_normalize(struct html_closure *closure, struct nmc_node *nodes)
+{
+        struct normalizer normalizer = { &closure->scratch, false, false };
+        closure->scratch.length = 0;
+        return (nmc_node_traverse(nodes, (nmc_node_traverse_fn)normalize_enter,
+                                  nmc_node_traverse_null, &normalizer,
+                                  closure->xml.error) &&
+                buffer_cstr(&closure->scratch) != NULL) ||
+                nmc_error_oom(closure->xml.error);
+}
+
+static bool
+html_normalize_string(struct html_closure *closure, const char *string)
+{
+        struct normalizer normalizer = { &closure->scratch, false, false };
+        closure->scratch.length = 0;
+        return ((string == NULL || normalize(&normalizer, string, strlen(string))) &&
+                buffer_cstr(&closure->scratch) != NULL) ||
+                nmc_error_oom(closure->xml.error);
+}
+
+static bool
+html_start(struct html_closure *closure, struct nmc_node *node)
+{
+        return element_start(&closure->xml, names[node->name].html,
+                             names[node->name].html_length);
+}
+
+static bool
+html_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        return element_end(&closure->xml, names[node->name].html,
+                           names[node->name].html_length);
+}
+
+static inline bool
+html_indent(struct html_closure *closure)
+{
+        return indent(&closure->xml, closure->xml.indent);
+}
+
+struct html_children {
+        size_t n;
+        bool first;
+        bool last;
+};
+
+// NOTE Count the children that html.xsl would output, where adjacent text
+// is merged, and note whether the first and last ones are elements.
+static void
+html_children(struct html_closure *closure, struct nmc_node *nodes,
+              struct html_children *children)
+{
+        list_for_each(struct nmc_node, p, nodes) {
+                if (p->name == NMC_NODE_GROUP ||
+                    (closure->hoisting > 0 && html_is_figure_link(p))) {
+                        html_children(closure, nmc_node_children(p), children);
+                        continue;
+                }
+                bool element = p->name != NMC_NODE_TEXT;
+                if (element || children->n == 0 || children->last) {
+                        if (children->n == 0)
+                                children->first = element;
+                        children->n++;
+                }
+                children->last = element;
+        }
+}
+
+// NOTE libxml2 puts a newline after the start tag of a block-level
+// element with more than one child, if the first one is an element, and
+// before the end tag, if the last one is.
+static bool
+html_format_start(struct html_closure *closure, struct nmc_node *node)
+{
+        struct html_children children = { 0, false, false };
+        html_children(closure, nmc_node_children(node), &children);
+        return children.n < 2 || !children.first || outc(&closure->xml, '\n');
+}
+
+static bool
+html_format_end(struct html_closure *closure, struct nmc_node *node)
+{
+        struct html_children children = { 0, false, false };
+        html_children(closure, nmc_node_children(node), &children);
+        return children.n < 2 || !children.last || outc(&closure->xml, '\n');
+}
+
+static bool
+html_document_enter(UNUSED(struct nmc_node *node), struct html_closure *closure)
+{
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_document_leave(UNUSED(struct nmc_node *node), struct html_closure *closure)
+{
+        closure->xml.indent--;
+        return html_indent(closure);
+}
+
+static bool
+html_title_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (html_ancestor_is(closure, 0, NMC_NODE_FIGURE))
+                return outs(&closure->xml, "<figcaption>", 12);
+        return html_indent(closure) && html_start(closure, node) &&
+                html_format_start(closure, node);
+}
+
+static bool
+html_title_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        if (html_ancestor_is(closure, 0, NMC_NODE_FIGURE))
+                return outs(&closure->xml, "</figcaption>", 13);
+        return html_format_end(closure, node) && html_leave(node, closure);
+}
+
+static bool
+html_title_name(struct html_closure *closure, struct nmc_node *section)
+{
+        struct nmc_node *title = nmc_node_children(section);
+        if (title == NULL || title->name != NMC_NODE_TITLE)
+                return true;
+        if (!html_normalize(closure, nmc_node_children(title)))
+                return false;
+        for (size_t i = 0; i < closure->scratch.length; i++) {
+                char c = closure->scratch.content[i];
+                if (c == ' ')
+                        c = '-';
+                else if ('A' <= c && c <= 'Z')
+                        c += 'a' - 'A';
+                else if (!(('a' <= c && c <= 'z') || ('0' <= c && c <= '9') ||
+                           c == '-'))
+                        continue;
+                if (!outc(&closure->xml, c))
+                        return false;
+        }
+        return true;
+}
+
+static bool
+html_section_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!(html_indent(closure) && outs(&closure->xml, "<section id=\"", 13)))
+                return false;
+        for (size_t i = 0; i < closure->n; i++)
+                if (closure->parents[i]->name == NMC_NODE_SECTION &&
+                    !(html_title_name(closure, closure->parents[i]) &&
+                      outc(&closure->xml, '-')))
+                        return false;
+        if (!(html_title_name(closure, node) && outs(&closure->xml, "\">", 2)))
+                return false;
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_block_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_indent(closure) && html_start(closure, node);
+}
+
+static bool
+html_text_block_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_block_enter(node, closure) && html_text(closure, node);
+}
+
+static bool
+html_indenting_block_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!html_block_enter(node, closure))
+                return false;
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_indenting_block_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        closure->xml.indent--;
+        return html_indent(closure) && html_leave(node, closure);
+}
+
+struct html_figures {
+        struct html_closure *closure;
+        size_t position;
+};
+
+static bool
+html_figure_link(struct nmc_node *node, struct html_figures *figures)
+{
+        if (!html_is_figure_link(node))
+                return true;
+        struct html_closure *closure = figures->closure;
+        const char *title = datum(node, "title");
+        figures->position++;
+        return html_normalize_string(closure, datum(node, "relation-data")) &&
+                outs(&closure->xml, "<figure class=\"figure-", 22) &&
+                (figures->position % 2 == 0 ?
+                 outs(&closure->xml, "left", 4) :
+                 outs(&closure->xml, "right", 5)) &&
+                outs(&closure->xml, "\"><img", 6) &&
+                html_uri_attribute(closure, "src", datum(node, "uri")) &&
+                html_attribute(closure, "alt", closure->scratch.content,
+                               closure->scratch.length) &&
+                outs(&closure->xml, "><figcaption>", 13) &&
+                (title == NULL || html_escape(closure, title, strlen(title), NULL)) &&
+                outs(&closure->xml, "</figcaption></figure>", 22);
+}
+
+// NOTE html.xsl moves figures linked to from paragraphs, quotes, and
+// tables in front of them, where the outermost one gets them all.
+static bool
+html_hoist(struct html_closure *closure, struct nmc_node *node)
+{
+        if (closure->hoisting++ > 0)
+                return true;
+        struct html_figures figures = { closure, 0 };
+        return nmc_node_traverse(nmc_node_children(node),
+                                 (nmc_node_traverse_fn)html_figure_link,
+                                 nmc_node_traverse_null, &figures,
+                                 closure->xml.error);
+}
+
+static bool
+html_paragraph_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_indent(closure) && html_hoist(closure, node) &&
+                html_start(closure, node);
+}
+
+static bool
+html_paragraph_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        closure->hoisting--;
+        return html_leave(node, closure);
+}
+
+static bool
+html_table_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!(html_indent(closure) && html_hoist(closure, node) &&
+              html_start(closure, node)))
+                return false;
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_table_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        closure->hoisting--;
+        return html_indenting_block_leave(node, closure);
+}
+
+static bool
+html_item_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!html_ancestor_is(closure, 0, NMC_NODE_DEFINITIONS))
+                return html_indenting_block_enter(node, closure);
+        if (!html_indent(closure))
+                return false;
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_item_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!html_ancestor_is(closure, 0, NMC_NODE_DEFINITIONS))
+                return html_indenting_block_leave(node, closure);
+        closure->xml.indent--;
+        return html_indent(closure);
+}
+
+static bool
+html_quote_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (html_in_flow(closure))
+                return html_table_enter(node, closure);
+        if (!html_indent(closure))
+                return false;
+        closure->xml.indent++;
+        return true;
+}
+
+static bool
+html_quote_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        if (html_in_flow(closure))
+                return html_table_leave(node, closure);
+        closure->xml.indent--;
+        return html_indent(closure);
+}
+
+static bool
+html_line_enter(UNUSED(struct nmc_node *node), struct html_closure *closure)
+{
+        return html_indent(closure);
+}
+
+static bool
+html_line_leave(UNUSED(struct nmc_node *node), struct html_closure *closure)
+{
+        return outs(&closure->xml, "<br>", 4);
+}
+
+static bool
+html_attribution_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        static const char dash[] = "<span class=\"attribution-dash\">—</span>";
+        struct html_children children = { 0, false, false };
+        html_children(closure, nmc_node_children(node), &children);
+        return html_indent(closure) &&
+                outs(&closure->xml, "<div class=\"attribution\">", 25) &&
+                (children.n == 0 || outc(&closure->xml, '\n')) &&
+                outs(&closure->xml, dash, sizeof(dash) - 1);
+}
+
+static bool
+html_attribution_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        struct html_children children = { 0, false, false };
+        html_children(closure, nmc_node_children(node), &children);
+        return (children.n == 0 || !children.last || outc(&closure->xml, '\n')) &&
+                html_leave(node, closure);
+}
+
+static bool
+html_codeblock_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_indent(closure) &&
+                (!html_in_flow(closure) || outs(&closure->xml, "<pre>", 5)) &&
+                html_start(closure, node) && html_text(closure, node);
+}
+
+static bool
+html_codeblock_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_leave(node, closure) &&
+                (!html_in_flow(closure) || outs(&closure->xml, "</pre>", 6));
+}
+
+static bool
+html_cell_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_indent(closure) &&
+                (html_ancestor_is(closure, 1, NMC_NODE_HEAD) ?
+                 outs(&closure->xml, "<th>", 4) :
+                 outs(&closure->xml, "<td>", 4)) &&
+                html_format_start(closure, node);
+}
+
+static bool
+html_cell_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_format_end(closure, node) &&
+                (html_ancestor_is(closure, 1, NMC_NODE_HEAD) ?
+                 outs(&closure->xml, "</th>", 5) :
+                 outs(&closure->xml, "</td>", 5));
+}
+
+static bool
+html_figure_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (!(html_indent(closure) && html_start(closure, node)))
+                return false;
+        closure->xml.indent++;
+        list_for_each(struct nmc_node, p, nmc_node_children(node))
+                if (p->name == NMC_NODE_IMAGE)
+                        return html_normalize(closure, nmc_node_children(p)) &&
+                                outs(&closure->xml, "<img", 4) &&
+                                html_uri_attribute(closure, "src", datum(p, "uri")) &&
+                                html_attribute(closure, "alt",
+                                               closure->scratch.content,
+                                               closure->scratch.length) &&
+                                outc(&closure->xml, '>');
+        return true;
+}
+
+static bool
+html_figure_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        closure->xml.indent--;
+        return html_leave(node, closure);
+}
+
+static bool
+html_image_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        closure->skip = node;
+        return true;
+}
+
+static bool
+html_inline_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_start(closure, node) && html_text(closure, node);
+}
+
+static bool
+html_abbreviation_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        const char *title = datum(node, "for");
+        if (title == NULL)
+                title = "";
+        return outs(&closure->xml, "<abbr", 5) &&
+                html_attribute(closure, "title", title, strlen(title)) &&
+                outc(&closure->xml, '>');
+}
+
+static bool
+html_link_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (closure->hoisting > 0 && html_is_figure_link(node))
+                return true;
+        const char *title = datum(node, "title");
+        const char *relation = datum(node, "relation");
+        return outs(&closure->xml, "<a", 2) &&
+                html_uri_attribute(closure, "href", datum(node, "uri")) &&
+                (title == NULL ||
+                 html_attribute(closure, "title", title, strlen(title))) &&
+                (relation == NULL ||
+                 html_attribute(closure, "rel", relation, strlen(relation))) &&
+                outc(&closure->xml, '>');
+}
+
+static bool
+html_link_leave(struct nmc_node *node, struct html_closure *closure)
+{
+        if (closure->hoisting > 0 && html_is_figure_link(node))
+                return true;
+        return html_leave(node, closure);
+}
+
+static bool
+html_text_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return html_text(closure, node);
+}
+
+static bool
+html_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        if (closure->skip != NULL)
+                return true;
+        if (!names[node->name].html_enter(node, closure))
+                return false;
+        if (!NODE_IS_NESTED(node) || closure->skip == node)
+                return true;
+        if (closure->n == closure->allocated) {
+                size_t n = closure->allocated == 0 ? 16 : 2 * closure->allocated;
+                struct nmc_node **parents = realloc(closure->parents,
+                                                    n * sizeof(*parents));
+                if (parents == NULL)
+                        return nmc_error_oom(closure->xml.error);
+                closure->parents = parents;
+                closure->allocated = n;
+        }
+        closure->parents[closure->n++] = node;
+        return true;
+}
+
+static bool
+html_exit(struct nmc_node *node, struct html_closure *closure)
+{
+        if (closure->skip != NULL) {
+                if (closure->skip == node)
+                        closure->skip = NULL;
+                return true;
+        }
+        closure->n--;
+        return names[node->name].html_leave(node, closure);
+}
+
+static bool
+html_string_enter(struct nmc_node *node, struct html_closure *closure)
+{
+        return node->type != NMC_NODE_TYPE_TEXT || html_text(closure, node);
+}
+
+static bool
+html_head(struct html_closure *closure, struct nmc_node *node)
+{
+        static const char head[] =
+                "<!DOCTYPE html>\n"
+                "<html>\n"
+                "<head>\n"
+                "<meta http-equiv=\"Content-Type\" content=\"text/html; charset=utf-8\">\n"
+                "<meta charset=\"utf-8\">\n"
+                "<link rel=\"stylesheet\" href=\"style.css\">\n"
+                "<title>";
+        static const char body[] = "</title>\n</head>\n<body><article>";
+        if (!outs(&closure->xml, head, sizeof(head) - 1))
+                return false;
+        if (node != NULL && node->name == NMC_NODE_DOCUMENT) {
+                struct nmc_node *title = nmc_node_children(node);
+                if (title != NULL && title->name == NMC_NODE_TITLE &&
+                    !nmc_node_traverse(nmc_node_children(title),
+                                       (nmc_node_traverse_fn)html_string_enter,
+                                       nmc_node_traverse_null, closure,
+                                       closure->xml.error))
+                        return false;
+        }
+        return outs(&closure->xml, body, sizeof(body) - 1);
+}
+
+bool
+nmc_node_html(const struct nmc_context *context, struct nmc_node *node,
+              struct nmc_output *output, struct nmc_error *error)
+{
+        struct html_closure closure = {
+                { context, output, 0, error }, NULL, 0, 0, 0, NULL, BUFFER_INIT
+        };
+        static const char tail[] = "</article></body>\n</html>\n";
+        bool r = html_head(&closure, node) &&
+                nmc_node_traverse(node, (nmc_node_traverse_fn)html_enter,
+                                  (nmc_node_traverse_fn)html_exit, &closure,
+                                  error) &&
+                outs(&closure.xml, tail, sizeof(tail) - 1);
+        free(closure.scratch.content);
+        free(closure.parents);
+        return r;
+}
+
+// NOTE The man output matches what data/xsl/man.xsl produces from the XML
+// output, including its quirks, like keeping the indentation whitespace of
+// figures.
+
+struct man_parent {
+        struct nmc_node *node;
+        size_t children;
+        bool lists;
+};
+
+struct man_closure {
+        struct xml_closure xml;
+        const char *const *params;
+        struct man_parent *parents;
+        size_t n;
+        size_t allocated;
+        size_t hoisting;
+        struct nmc_node *skip;
+        struct buffer inlines;
+        struct buffer scratch;
+};
+
+typedef bool (*mantraversefn)(struct nmc_node *, struct man_closure *);
+
+static inline struct man_parent *
+man_ancestor(struct man_closure *closure, size_t i)
+{
+        return i < closure->n ? &closure->parents[closure->n - 1 - i] : NULL;
+}
+
+static inline bool
+man_ancestor_is(struct man_closure *closure, size_t i, enum nmc_node_name name)
+{
+        struct man_parent *p = man_ancestor(closure, i);
+        return p != NULL && p->node->name == name;
+}
+
+static PURE bool
+man_in_item(struct man_closure *closure)
+{
+        for (size_t i = 0; i < closure->n; i++)
+                if (closure->parents[i].node->name == NMC_NODE_ITEM)
+                        return true;
+        return false;
+}
+
+// NOTE man.xsl only treats quotes and code blocks as blocks in these.
+static bool
+man_is_flow(struct man_parent *parent)
+{
+        if (parent == NULL)
+                return false;
+        switch (parent->node->name) {
+        case NMC_NODE_DOCUMENT:
+        case NMC_NODE_SECTION:
+        case NMC_NODE_ITEM:
+        case NMC_NODE_DEFINITION:
+                return true;
+        default:
+                return false;
+        }
+}
+
+static inline bool
+man_in_flow(struct man_closure *closure)
+{
+        return man_is_flow(man_ancestor(closure, 0));
+}
+
+static PURE const char *
+man_param(struct man_closure *closure, const char *name, const char *otherwise)
+{
+        if (closure->params != NULL)
+                for (const char *const *p = closure->params; *p != NULL; p += 2)
+                        if (strcmp(*p, name) == 0)
+                                return p[1];
+        return otherwise;
+}
+
+// NOTE Like html_escape(), *cr tracks line endings, which are normalized
+// as an XML parser would.  Text may also be escaped for roff.
+static bool
+man_append(struct buffer *buffer, const char *string, size_t length,
+           bool escape, bool *cr)
+{
+        const char *s = string;
+        const char *end = s + length;
+        const char *p = s;
+        for (; p < end; p++) {
+                const char *e;
+                switch (*p) {
+                case '\r':
+                        e = "\n";
+                        break;
+                case '\n':
+                        if (!*cr)
+                                continue;
+                        e = "";
+                        break;
+                case '\\':
+                        e = escape ? "\\e" : NULL;
+                        break;
+                case '-':
+                        e = escape ? "\\-" : NULL;
+                        break;
+                default:
+                        e = NULL;
+                }
+                *cr = *p == '\r';
+                if (e == NULL)
+                        continue;
+                if (!(buffer_append(buffer, s, p - s) &&
+                      buffer_append(buffer, e, strlen(e))))
+                        return false;
+                s = p + 1;
+        }
+        return buffer_append(buffer, s, p - s);
+}
+
+static bool
+man_text(struct buffer *buffer, struct nmc_node *node, bool escape)
+{
+        bool cr = false;
+        list_for_each(struct nmc_text, p, &((struct nmc_text_node *)node)->text)
+                if (!man_append(buffer, p->string, p->length, escape, &cr))
+                        return false;
+        return true;
+}
+
+static bool
+man_string_enter(struct nmc_node *node, struct buffer *buffer)
+{
+        return node->type != NMC_NODE_TYPE_TEXT || man_text(buffer, node, false);
+}
+
+// NOTE This is the string value of node, as XPath sees it.
+static bool
+man_string(struct man_closure *closure, struct nmc_node *node)
+{
+        closure->scratch.length = 0;
+        return (nmc_node_traverse(nmc_node_children(node),
+                                  (nmc_node_traverse_fn)man_string_enter,
+                                  nmc_node_traverse_null, &closure->scratch,
+                                  closure->xml.error) &&
+                buffer_cstr(&closure->scratch) != NULL) ||
+                nmc_error_oom(closure->xml.error);
+}
+
+static bool
+man_inline_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        struct buffer *b = &closure->inlines;
+        switch (node->name) {
+        case NMC_NODE_TEXT:
+                return man_text(b, node, true);
+        case NMC_NODE_EMPHASIS:
+                return buffer_append(b, "\\fI", 3) && man_text(b, node, true) &&
+                        buffer_append(b, "\\fR", 3);
+        case NMC_NODE_CODE:
+                return buffer_append(b, "\\FC", 3) && man_text(b, node, true) &&
+                        buffer_append(b, "\\F[]", 4);
+        default:
+                return true;
+        }
+}
+
+static bool
+man_inline_leave(struct nmc_node *node, struct man_closure *closure)
+{
+        if (node->name != NMC_NODE_LINK ||
+            (closure->hoisting > 0 && html_is_figure_link(node)))
+                return true;
+        struct buffer *b = &closure->inlines;
+        const char *title = datum(node, "title");
+        const char *uri = datum(node, "uri");
+        if (uri == NULL)
+                uri = "";
+        return buffer_append(b, " (", 2) &&
+                (title == NULL ||
+                 (buffer_append(b, title, strlen(title)) &&
+                  buffer_append(b, " at ", 4))) &&
+                buffer_append(b, "\\fB", 3) &&
+                buffer_append(b, uri, strlen(uri)) &&
+                buffer_append(b, "\\fR)", 4);
+}
+
+// NOTE Render the inlines of node into closure->inlines.
+static bool
+man_inlines(struct man_closure *closure, struct nmc_node *node)
+{
+        closure->inlines.length = 0;
+        if (node->type == NMC_NODE_TYPE_TEXT)
+                return man_text(&closure->inlines, node, true) ||
+                        nmc_error_oom(closure->xml.error);
+        return nmc_node_traverse(nmc_node_children(node),
+                                 (nmc_node_traverse_fn)man_inline_enter,
+                                 (nmc_node_traverse_fn)man_inline_leave,
+                                 closure, closure->xml.error) ||
+                nmc_error_oom(closure->xml.error);
+}
+
+static bool
+man_outs(struct man_closure *closure, const char *string)
+{
+        return outs(&closure->xml, string, strlen(string));
+}
+
+static inline bool
+man_outb(struct man_closure *closure, struct buffer *buffer)
+{
+        return buffer->length == 0 ||
+                outs(&closure->xml, buffer->content, buffer->length);
+}
+
+static bool
+man_normalized(struct man_closure *closure, struct nmc_node *node)
+{
+        struct normalizer normalizer = { &closure->scratch, false, false };
+        closure->scratch.length = 0;
+        return man_inlines(closure, node) &&
+                (normalize(&normalizer, closure->inlines.content,
+                           closure->inlines.length) ||
+                 nmc_error_oom(closure->xml.error)) &&
+                man_outb(closure, &closure->scratch);
+}
+
+// NOTE Quote a macro argument, if needed.  man.xsl never escapes them.
+static bool
+man_argument(struct man_closure *closure, const char *string, size_t length)
+{
+        if (length > 0 && memchr(string, ' ', length) == NULL)
+                return outs(&closure->xml, string, length);
+        return outc(&closure->xml, '"') &&
+                outs(&closure->xml, string, length) &&
+                outc(&closure->xml, '"');
+}
+
+static bool
+man_upcased_argument(struct man_closure *closure)
+{
+        for (size_t i = 0; i < closure->scratch.length; i++) {
+                char c = closure->scratch.content[i];
+                if ('a' <= c && c <= 'z')
+                        closure->scratch.content[i] = c - 'a' + 'A';
+        }
+        return man_argument(closure, closure->scratch.content,
+                            closure->scratch.length);
+}
+
+static bool
+man_date(struct man_closure *closure)
+{
+        static const char *const months[] = {
+                "January", "February", "March", "April", "May", "June", "July",
+                "August", "September", "October", "November", "December"
+        };
+        const char *date = man_param(closure, "date", NULL);
+        if (date != NULL)
+                return man_argument(closure, date, strlen(date));
+        // NOTE Like libxslt, honor SOURCE_DATE_EPOCH for reproducible builds.
+        const char *epoch = getenv("SOURCE_DATE_EPOCH");
+        time_t t = time(NULL);
+        bool utc = false;
+        if (epoch != NULL) {
+                char *end;
+                errno = 0;
+                long long seconds = strtoll(epoch, &end, 10);
+                if (*epoch != '\0' && *end == '\0' && errno == 0 &&
+                    (time_t)seconds == seconds) {
+                        t = (time_t)seconds;
+                        utc = true;
+                }
+        }
+        struct tm tm;
+        if ((utc ? gmtime_r(&t, &tm) : localtime_r(&t, &tm)) == NULL)
+                return nmc_error_init(closure->xml.error, errno,
+                                      "can’t determine date");
+        char s[64];
+        int n = snprintf(s, sizeof(s), "\"%d %s, %d\"", tm.tm_mday,
+                         months[tm.tm_mon], tm.tm_year + 1900);
+        return outs(&closure->xml, s, (size_t)n);
+}
+
+static bool
+man_document_title(struct nmc_node *node, struct man_closure *closure)
+{
+        if (!man_string(closure, node))
+                return false;
+        char *title = closure->scratch.content;
+        size_t length = closure->scratch.length;
+        char *open = memchr(title, '(', length);
+        const char *section = NULL;
+        size_t section_length = 0;
+        if (open != NULL) {
+                char *close = memchr(open + 1, ')', title + length - (open + 1));
+                if (close != NULL && close > open + 1) {
+                        section = open + 1;
+                        section_length = close - section;
+                }
+        }
+        if (section == NULL) {
+                section = man_param(closure, "section", "1");
+                section_length = strlen(section);
+        }
+        size_t title_length = open != NULL && open > title ? (size_t)(open - title) : length;
+        if (!man_outs(closure, ".TH "))
+                return false;
+        closure->scratch.length = title_length;
+        const char *source = man_param(closure, "source", "");
+        const char *manual = man_param(closure, "manual", "User Commands");
+        return man_upcased_argument(closure) &&
+                outc(&closure->xml, ' ') &&
+                outs(&closure->xml, section, section_length) &&
+                outc(&closure->xml, ' ') &&
+                man_date(closure) &&
+                outc(&closure->xml, ' ') &&
+                man_argument(closure, source, strlen(source)) &&
+                outc(&closure->xml, ' ') &&
+                man_argument(closure, manual, strlen(manual)) &&
+                outc(&closure->xml, '\n');
+}
+
+static bool
+man_skip(struct nmc_node *node, struct man_closure *closure)
+{
+        closure->skip = node;
+        return true;
+}
+
+static bool
+man_title_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        if (man_ancestor_is(closure, 0, NMC_NODE_DOCUMENT) &&
+            !man_document_title(node, closure))
+                return false;
+        if (man_ancestor_is(closure, 0, NMC_NODE_FIGURE) &&
+            !(man_inlines(closure, node) &&
+              man_outs(closure, ".sp\n\\fB") &&
+              man_outb(closure, &closure->inlines) &&
+              man_outs(closure, "\\fR\n")))
+                return false;
+        return man_skip(node, closure);
+}
+
+static PURE struct nmc_node *
+man_title(struct nmc_node *section)
+{
+        struct nmc_node *title = nmc_node_children(section);
+        return title != NULL && title->name == NMC_NODE_TITLE ? title : NULL;
+}
+
+static bool
+man_section_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        size_t level = 0;
+        for (size_t i = 0; i < closure->n; i++)
+                if (closure->parents[i].node->name == NMC_NODE_SECTION)
+                        level++;
+        if (level > 1)
+                return nmc_error_init(closure->xml.error, -1,
+                                      "can’t nest sections more than two "
+                                      "levels deep in man pages");
+        struct nmc_node *title = man_title(node);
+        closure->scratch.length = 0;
+        if (title != NULL && !man_string(closure, title))
+                return false;
+        if (level == 0)
+                return man_outs(closure, ".SH ") &&
+                        man_upcased_argument(closure) &&
+                        outc(&closure->xml, '\n');
+        return man_outs(closure, ".SS ") &&
+                man_argument(closure, closure->scratch.content,
+                             closure->scratch.length) &&
+                outc(&closure->xml, '\n');
+}
+
+static bool
+man_figure_link_exists(struct nmc_node *node, bool *found)
+{
+        if (html_is_figure_link(node))
+                *found = true;
+        return true;
+}
+
+static bool
+man_has_figures(struct man_closure *closure, struct nmc_node *node)
+{
+        bool found = false;
+        return nmc_node_traverse(nmc_node_children(node),
+                                 (nmc_node_traverse_fn)man_figure_link_exists,
+                                 nmc_node_traverse_null, &found,
+                                 closure->xml.error) && found;
+}
+
+static bool
+man_figure_link(struct nmc_node *node, struct man_closure *closure)
+{
+        if (!html_is_figure_link(node))
+                return true;
+        const char *title = datum(node, "title");
+        const char *alternate = datum(node, "relation-data");
+        bool cr = false;
+        closure->inlines.length = 0;
+        if (!(man_outs(closure, ".PP\n.RS 4\n.sp\n\\fB") &&
+              (title == NULL ||
+               man_append(&closure->inlines, title, strlen(title), true, &cr) ||
+               nmc_error_oom(closure->xml.error)) &&
+              man_outb(closure, &closure->inlines) &&
+              man_outs(closure, "\\fR\n[IMAGE ")))
+                return false;
+        closure->inlines.length = 0;
+        cr = false;
+        return (alternate == NULL ||
+                man_append(&closure->inlines, alternate, strlen(alternate), true, &cr) ||
+                nmc_error_oom(closure->xml.error)) &&
+                man_outb(closure, &closure->inlines) &&
+                man_outs(closure, "]\n.RE\n");
+}
+
+// NOTE Like html_hoist(), only the outermost paragraph, quote, or table
+// gets the figures.
+static bool
+man_hoist(struct man_closure *closure, struct nmc_node *node)
+{
+        if (closure->hoisting++ > 0)
+                return true;
+        return nmc_node_traverse(nmc_node_children(node),
+                                 (nmc_node_traverse_fn)man_figure_link,
+                                 nmc_node_traverse_null, closure,
+                                 closure->xml.error);
+}
+
+static bool
+man_unhoist(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        closure->hoisting--;
+        return true;
+}
+
+static bool
+man_paragraph_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        if (!man_hoist(closure, node))
+                return false;
+        bool item = man_in_item(closure);
+        if (!((item || man_outs(closure, ".sp\n")) &&
+              man_normalized(closure, node) &&
+              outc(&closure->xml, '\n')))
+                return false;
+        if (item && node->next != NULL &&
+            node->next->name == NMC_NODE_PARAGRAPH &&
+            !man_has_figures(closure, node->next) &&
+            !man_outs(closure, ".sp\n"))
+                return false;
+        return man_skip(node, closure);
+}
+
+static bool
+man_list_leave(struct nmc_node *node, struct man_closure *closure)
+{
+        return node->next == NULL || !man_in_item(closure) ||
+                man_outs(closure, ".sp\n");
+}
+
+static bool
+man_item_enter(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        struct man_parent *parent = man_ancestor(closure, 0);
+        const char *designator;
+        const char *indent;
+        char number[32];
+        switch (parent->node->name) {
+        case NMC_NODE_ITEMIZATION:
+                designator = "\\(bu";
+                indent = "2.3";
+                break;
+        case NMC_NODE_ENUMERATION:
+                snprintf(number, sizeof(number), parent->children < 10 ?
+                         " %zu." : "%zu.", parent->children);
+                designator = number;
+                indent = "4.2";
+                break;
+        default:
+                return true;
+        }
+        size_t length = designator == number ? strlen(number) : 1;
+        char advance[32];
+        snprintf(advance, sizeof(advance), "%d", 4 - (int)length);
+        return man_outs(closure, ".sp\n.RS 4\n.ie n \\{\\\n\\h'-04'") &&
+                man_outs(closure, designator) &&
+                man_outs(closure, "\\h'+0") &&
+                man_outs(closure, advance) &&
+                man_outs(closure, "'\\c\n.\\}\n.el \\{\\\n.sp -1\n.IP ") &&
+                man_argument(closure, designator, strlen(designator)) &&
+                outc(&closure->xml, ' ') &&
+                man_outs(closure, indent) &&
+                man_outs(closure, "\n.\\}\n");
+}
+
+static bool
+man_item_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return man_ancestor_is(closure, 0, NMC_NODE_DEFINITIONS) ||
+                man_outs(closure, ".RE\n");
+}
+
+static bool
+man_item_exists(struct nmc_node *node, bool *found)
+{
+        if (node->name == NMC_NODE_ITEM)
+                *found = true;
+        return true;
+}
+
+// NOTE Definitions with lists in them are output as indented paragraphs
+// instead of tagged ones.
+static bool
+man_definitions_lists(struct man_closure *closure, struct nmc_node *node,
+                      bool *lists)
+{
+        *lists = false;
+        list_for_each(struct nmc_node, item, nmc_node_children(node))
+                list_for_each(struct nmc_node, p, nmc_node_children(item))
+                        if (p->name == NMC_NODE_DEFINITION &&
+                            !nmc_node_traverse(nmc_node_children(p),
+                                               (nmc_node_traverse_fn)man_item_exists,
+                                               nmc_node_traverse_null, lists,
+                                               closure->xml.error))
+                                return false;
+        return true;
+}
+
+static bool
+man_definitions_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        // NOTE The entry of node has just been popped, but is still there.
+        return closure->parents[closure->n].lists ||
+                man_outs(closure, ".PP\n.sp -1\n");
+}
+
+static bool
+man_term_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_outs(closure, man_ancestor(closure, 1)->lists ?
+                        ".PP\n\\fB" : ".TP\n\\fB") &&
+                man_normalized(closure, node) &&
+                man_outs(closure, "\\fP\n");
+}
+
+static bool
+man_definition_enter(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return !man_ancestor(closure, 1)->lists || man_outs(closure, ".RS 4\n");
+}
+
+static bool
+man_definition_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return !man_ancestor(closure, 1)->lists || man_outs(closure, ".RE\n");
+}
+
+static bool
+man_quote_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return !man_in_flow(closure) ||
+                (man_hoist(closure, node) && man_outs(closure, ".sp\n.RS 4\n"));
+}
+
+static bool
+man_quote_leave(struct nmc_node *node, struct man_closure *closure)
+{
+        return !man_in_flow(closure) ||
+                (man_unhoist(node, closure) && man_outs(closure, ".RE\n"));
+}
+
+static bool
+man_line_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_normalized(closure, node) && man_outs(closure, "\n.br\n") &&
+                man_skip(node, closure);
+}
+
+static bool
+man_attribution_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_outs(closure, "\\(em\\ ") && man_normalized(closure, node) &&
+                outc(&closure->xml, '\n') && man_skip(node, closure);
+}
+
+static bool
+man_synopsis(struct man_closure *closure, bool *synopsis)
+{
+        *synopsis = false;
+        if (!man_ancestor_is(closure, 0, NMC_NODE_SECTION))
+                return true;
+        struct nmc_node *title = man_title(man_ancestor(closure, 0)->node);
+        if (title == NULL)
+                return true;
+        if (!man_string(closure, title))
+                return false;
+        *synopsis = strcmp(closure->scratch.content, "Synopsis") == 0;
+        return true;
+}
+
+static bool
+man_codeblock_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        bool synopsis;
+        if (!(man_inlines(closure, node) && man_synopsis(closure, &synopsis)))
+                return false;
+        if (!synopsis && !man_in_flow(closure))
+                return man_outs(closure, "\\FC") &&
+                        man_outb(closure, &closure->inlines) &&
+                        man_outs(closure, "\\F[]");
+        if (!((synopsis || man_outs(closure, ".sp\n.RS 4\n")) &&
+              man_outs(closure, ".nf\n")))
+                return false;
+        // NOTE Lines starting with a control character are escaped.
+        const char *s = closure->inlines.content;
+        const char *end = s + closure->inlines.length;
+        for (const char *p = s; (p = memchr(p, '\n', end - p)) != NULL; ) {
+                p++;
+                if (p < end && (*p == '.' || *p == '\'')) {
+                        if (!(outs(&closure->xml, s, p - s) &&
+                              outs(&closure->xml, "\\&", 2)))
+                                return false;
+                        s = p;
+                }
+        }
+        return outs(&closure->xml, s, end - s) &&
+                man_outs(closure, "\n.fi\n") &&
+                (synopsis || man_outs(closure, ".RE\n"));
+}
+
+static bool
+man_rows_format(struct man_closure *closure, struct nmc_node *node)
+{
+        bool head = node->name == NMC_NODE_HEAD;
+        list_for_each(struct nmc_node, row, nmc_node_children(node)) {
+                list_for_each(struct nmc_node, cell, nmc_node_children(row))
+                        if (!man_outs(closure,
+                                      cell == nmc_node_children(row) ?
+                                      (head ? "cB" : "l") :
+                                      (head ? " cB" : " l")))
+                                return false;
+                if (!man_outs(closure, row->next == NULL ? ".\n" : "\n"))
+                        return false;
+        }
+        return true;
+}
+
+static bool
+man_rows_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_rows_format(closure, node);
+}
+
+static bool
+man_table_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_hoist(closure, node) && man_outs(closure, ".RS 4\n.TS\n");
+}
+
+static bool
+man_table_leave(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_unhoist(node, closure) && man_outs(closure, ".TE\n.RE\n");
+}
+
+static bool
+man_head_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return man_outs(closure, ".T&\n");
+}
+
+static bool
+man_row_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return outc(&closure->xml, '\n');
+}
+
+static bool
+man_cell_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_inlines(closure, node) &&
+                man_outs(closure, man_ancestor(closure, 0)->children == 1 ?
+                         "T{\n" : "\tT{\n") &&
+                man_outb(closure, &closure->inlines) &&
+                man_outs(closure, "\nT}") &&
+                man_skip(node, closure);
+}
+
+static bool
+man_figure_enter(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return man_outs(closure, ".PP\n.RS 4\n");
+}
+
+static bool
+man_figure_leave(UNUSED(struct nmc_node *node), struct man_closure *closure)
+{
+        return man_outs(closure, ".RE\n");
+}
+
+static bool
+man_image_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        return man_inlines(closure, node) &&
+                man_outs(closure, "[IMAGE ") &&
+                man_outb(closure, &closure->inlines) &&
+                man_outs(closure, "]\n") &&
+                man_skip(node, closure);
+}
+
+static bool
+man_null(UNUSED(struct nmc_node *node), UNUSED(struct man_closure *closure))
+{
+        return true;
+}
+
+static const struct {
+        mantraversefn enter;
+        mantraversefn leave;
+} mans[] = {
+#define MAN(kind) man_##kind##_enter, man_##kind##_leave
+        [NMC_NODE_DOCUMENT] = { man_null, man_null },
+        [NMC_NODE_TITLE] = { man_title_enter, man_null },
+        [NMC_NODE_SECTION] = { man_section_enter, man_null },
+        [NMC_NODE_PARAGRAPH] = { man_paragraph_enter, man_unhoist },
+        [NMC_NODE_ITEMIZATION] = { man_null, man_list_leave },
+        [NMC_NODE_ENUMERATION] = { man_null, man_list_leave },
+        [NMC_NODE_ITEM] = { MAN(item) },
+        [NMC_NODE_DEFINITIONS] = { man_null, man_definitions_leave },
+        [NMC_NODE_TERM] = { man_term_enter, man_null },
+        [NMC_NODE_DEFINITION] = { MAN(definition) },
+        [NMC_NODE_QUOTE] = { MAN(quote) },
+        [NMC_NODE_LINE] = { man_line_enter, man_null },
+        [NMC_NODE_ATTRIBUTION] = { man_attribution_enter, man_null },
+        [NMC_NODE_CODEBLOCK] = { man_codeblock_enter, man_null },
+        [NMC_NODE_TABLE] = { MAN(table) },
+        [NMC_NODE_HEAD] = { man_rows_enter, man_head_leave },
+        [NMC_NODE_BODY] = { man_rows_enter, man_null },
+        [NMC_NODE_ROW] = { man_null, man_row_leave },
+        [NMC_NODE_CELL] = { man_cell_enter, man_null },
+        [NMC_NODE_FIGURE] = { MAN(figure) },
+        [NMC_NODE_IMAGE] = { man_image_enter, man_null },
+        [NMC_NODE_CODE] = { man_null, man_null },
+        [NMC_NODE_EMPHASIS] = { man_null, man_null },
+        [NMC_NODE_GROUP] = { man_null, man_null },
+        [NMC_NODE_ABBREVIATION] = { man_null, man_null },
+        [NMC_NODE_LINK] = { man_null, man_null },
+        [NMC_NODE_TEXT] = { man_null, man_null },
+#undef MAN
+};
+
+// NOTE man.xsl keeps the indentation whitespace inside figures and
+// quotes that it doesn’t treat as blocks, as it doesn’t strip space from
+// them.  This checks the innermost parent.
+static bool
+man_keeps_space(struct man_closure *closure)
+{
+        struct man_parent *parent = man_ancestor(closure, 0);
+        if (parent == NULL)
+                return false;
+        switch (parent->node->name) {
+        case NMC_NODE_FIGURE:
+                return true;
+        case NMC_NODE_QUOTE:
+                return !man_is_flow(man_ancestor(closure, 1));
+        default:
+                return false;
+        }
+}
+
+static bool
+man_enter(struct nmc_node *node, struct man_closure *closure)
+{
+        if (closure->skip != NULL)
+                return true;
+        if (closure->n > 0)
+                closure->parents[closure->n - 1].children++;
+        if (man_keeps_space(closure) && !indent(&closure->xml, closure->n))
+                return false;
+        if (!mans[node->name].enter(node, closure))
+                return false;
+        if (!NODE_IS_NESTED(node))
+                return true;
+        bool lists = false;
+        if (node->name == NMC_NODE_DEFINITIONS &&
+            !man_definitions_lists(closure, node, &lists))
+                return false;
+        if (closure->n == closure->allocated) {
+                size_t n = closure->allocated == 0 ? 16 : 2 * closure->allocated;
+                struct man_parent *parents = realloc(closure->parents,
+                                                     n * sizeof(*parents));
+                if (parents == NULL)
+                        return nmc_error_oom(closure->xml.error);
+                closure->parents = parents;
+                closure->allocated = n;
+        }
+        closure->parents[closure->n++] = (struct man_parent){ node, 0, lists };
+        return true;
+}
+
+static bool
+man_leave(struct nmc_node *node, struct man_closure *closure)
+{
+        if (closure->skip != NULL) {
+                if (closure->skip != node)
+                        return true;
+                closure->skip = NULL;
+        }
+        if (man_keeps_space(closure) && !indent(&closure->xml, closure->n - 1))
+                return false;
+        closure->n--;
+        return mans[node->name].leave(node, closure);
+}
+
+bool
+nmc_node_man(const struct nmc_context *context, struct nmc_node *node,
+             const char *const *params, struct nmc_output *output,
+             struct nmc_error *error)
+{
+        struct man_closure closure = {
+                { context, output, 0, error }, params, NULL, 0, 0, 0, NULL,
+                BUFFER_INIT, BUFFER_INIT
+        };
+        bool r = nmc_node_traverse(node, (nmc_node_traverse_fn)man_enter,
+                                   (nmc_node_traverse_fn)man_leave, &closure,
+                                   error);
+        free(closure.scratch.content);
+        free(closure.inlines.content);
+        free(closure.parents);
+        return r;
+}
+
 PURE const char *
 nmc_node_name(struct nmc_node *node)
 {
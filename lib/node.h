@@ -0,0 +1,13 @@
+#define NODE_IS_NESTED(n) ((n)->name < NMC_NODE_TEXT)
+
+// NOTE Write the XML of a document in pieces, as it’s parsed: its
+// beginning, up to and including the title and blocks that precede its
+// sections, given as a list, then each top-level section, then its end.
+bool xml_document_begin(const struct nmc_context *context,
+                        struct nmc_node *children, struct nmc_output *output,
+                        struct nmc_error *error);
+bool xml_document_section(const struct nmc_context *context,
+                          struct nmc_node *section, struct nmc_output *output,
+                          struct nmc_error *error);
+bool xml_document_end(const struct nmc_context *context,
+                      struct nmc_output *output, struct nmc_error *error);
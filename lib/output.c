@@ -1,10 +1,12 @@
 #include <config.h>
 
 #include <errno.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <nmc.h>
@@ -13,9 +15,21 @@
 
 #include "error.h"
 
-bool
-nmc_output_write_all(struct nmc_output *output, const char *string,
-                     size_t length, size_t *written, struct nmc_error *error)
+void
+nmc_output_init(struct nmc_output *output, nmc_output_write_fn write,
+                nmc_output_close_fn close)
+{
+        output->write = write;
+        output->close = close;
+        output->buffer = NULL;
+        output->size = 0;
+        output->length = 0;
+        output->writev = NULL;
+}
+
+static bool
+write_all(struct nmc_output *output, const char *string, size_t length,
+          size_t *written, struct nmc_error *error)
 {
         size_t n = 0;
         while (n < length) {
@@ -30,9 +44,90 @@ nmc_output_write_all(struct nmc_output *output, const char *string,
         return true;
 }
 
+bool
+nmc_output_flush(struct nmc_output *output, struct nmc_error *error)
+{
+        size_t w;
+        bool r = write_all(output, output->buffer, output->length, &w, error);
+        if (w < output->length)
+                memmove(output->buffer, output->buffer + w, output->length - w);
+        output->length -= w;
+        return r;
+}
+
+bool
+nmc_output_write_all(struct nmc_output *output, const char *string,
+                     size_t length, size_t *written, struct nmc_error *error)
+{
+        if (length >= output->size - output->length) {
+                if (!nmc_output_flush(output, error)) {
+                        *written = 0;
+                        return false;
+                }
+                if (length >= output->size)
+                        return write_all(output, string, length, written, error);
+        }
+        memcpy(output->buffer + output->length, string, length);
+        output->length += length;
+        *written = length;
+        return true;
+}
+
+#ifndef IOV_MAX
+#  define IOV_MAX 16
+#endif
+
+// NOTE Writes the strings of iov in order, after what’s in the buffer, and
+// uses iov up doing so.  Without writev, they’re written one by one.
+bool
+nmc_output_writev(struct nmc_output *output, struct iovec *iov, size_t n,
+                  struct nmc_error *error)
+{
+        if (output->writev == NULL) {
+                size_t written;
+                for (size_t i = 0; i < n; i++)
+                        if (!nmc_output_write_all(output, iov[i].iov_base,
+                                                  iov[i].iov_len, &written,
+                                                  error))
+                                return false;
+                return true;
+        }
+        if (!nmc_output_flush(output, error))
+                return false;
+        size_t i = 0;
+        while (i < n) {
+                ssize_t w = output->writev(output, iov + i,
+                                           n - i > IOV_MAX ? IOV_MAX : (int)(n - i),
+                                           error);
+                if (w == -1)
+                        return false;
+                for (; i < n && (size_t)w >= iov[i].iov_len; i++)
+                        w -= iov[i].iov_len;
+                if (w > 0) {
+                        iov[i].iov_base = (char *)iov[i].iov_base + w;
+                        iov[i].iov_len -= w;
+                }
+        }
+        return true;
+}
+
+bool
+nmc_output_write_slow(struct nmc_output *output, const char *string,
+                      size_t length, struct nmc_error *error)
+{
+        size_t written;
+        return nmc_output_write_all(output, string, length, &written, error);
+}
+
 bool
 nmc_output_close(struct nmc_output *output, struct nmc_error *error)
 {
+        if (!nmc_output_flush(output, error)) {
+                struct nmc_error ignored;
+                if (output->close != NULL)
+                        output->close(output, &ignored);
+                return false;
+        }
         return output->close == NULL || output->close(output, error);
 }
 
@@ -53,56 +148,68 @@ nmc_fd_output_write(struct nmc_fd_output *output, const char *string,
         }
 }
 
+static ssize_t
+nmc_fd_output_writev(struct nmc_fd_output *output, const struct iovec *iov,
+                     int n, struct nmc_error *error)
+{
+        while (true) {
+                ssize_t w = writev(output->fd, iov, n);
+                if (w == -1) {
+                        if (errno == EAGAIN || errno == EINTR)
+                                continue;
+                        nmc_error_init(error, errno, "can’t write to file");
+                }
+                return w;
+        }
+}
+
 void
 nmc_fd_output_init(struct nmc_fd_output *output, int fd)
 {
-        output->output.write = (nmc_output_write_fn)nmc_fd_output_write;
-        output->output.close = NULL;
+        nmc_output_init(&output->output,
+                        (nmc_output_write_fn)nmc_fd_output_write, NULL);
+        output->output.writev = (nmc_output_writev_fn)nmc_fd_output_writev;
         output->fd = fd;
 }
 
-static bool
-flush(struct nmc_buffered_output *output, struct nmc_error *error)
+static ssize_t
+nmc_buffered_output_write(struct nmc_buffered_output *output,
+                          const char *string, size_t length,
+                          struct nmc_error *error)
 {
         size_t w;
-        bool r = nmc_output_write_all(output->real, output->buffer,
-                                      output->length, &w, error);
-        if (w < output->length)
-                memmove(output->buffer, output->buffer + w, output->length - w);
-        output->length -= w;
-        return r;
+        return nmc_output_write_all(output->real, string, length, &w, error) ?
+                (ssize_t)w : -1;
 }
 
 static ssize_t
-nmc_buffered_output_write(struct nmc_buffered_output *output,
-                          const char *string, size_t length,
-                          struct nmc_error *error)
+nmc_buffered_output_writev(struct nmc_buffered_output *output,
+                           const struct iovec *iov, int n,
+                           struct nmc_error *error)
 {
-        if (output->length == sizeof(output->buffer) && !flush(output, error))
-                return -1;
-        size_t r = sizeof(output->buffer) - output->length;
-        size_t n = r < length ? r : length;
-        memcpy(output->buffer + output->length, string, n);
-        output->length += n;
-        return n;
+        struct nmc_output *real = output->real;
+        return nmc_output_flush(real, error) ?
+                real->writev(real, iov, n, error) : -1;
 }
 
 static bool
 nmc_buffered_output_close(struct nmc_buffered_output *output,
                           struct nmc_error *error)
 {
-        if (flush(output, error))
-                return nmc_output_close(output->real, error);
-        struct nmc_error ignored;
-        nmc_output_close(output->real, &ignored);
-        return false;
+        return nmc_output_close(output->real, error);
 }
 
 void
-nmc_buffered_output_init(struct nmc_buffered_output *output, struct nmc_output *real)
+nmc_buffered_output_init(struct nmc_buffered_output *output,
+                         struct nmc_output *real, char *buffer, size_t size)
 {
-        output->output.write = (nmc_output_write_fn)nmc_buffered_output_write;
-        output->output.close = (nmc_output_close_fn)nmc_buffered_output_close;
+        nmc_output_init(&output->output,
+                        (nmc_output_write_fn)nmc_buffered_output_write,
+                        (nmc_output_close_fn)nmc_buffered_output_close);
+        output->output.buffer = buffer;
+        output->output.size = size;
+        if (real->writev != NULL)
+                output->output.writev =
+                        (nmc_output_writev_fn)nmc_buffered_output_writev;
         output->real = real;
-        output->length = 0;
 }
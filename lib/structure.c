@@ -0,0 +1,328 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_SSE2
+#  include <emmintrin.h>
+#endif
+#ifdef HAVE_AVX2
+#  include <immintrin.h>
+#endif
+
+#include <private.h>
+
+#include "structure.h"
+
+// NOTE Specials are what the lexer may have to stop a word at or treat
+// as something other than text.  This must agree with parser_lex() and
+// word() in grammar.y.
+static inline bool
+is_special(unsigned char c)
+{
+        switch (c) {
+        case '\0': case '\n': case ' ':
+        case '|': case '/': case '{': case '}':
+                return true;
+        default:
+                return c >= 0x80;
+        }
+}
+
+static void
+index_block_scalar(struct structure_block *block, const unsigned char *p)
+{
+        uint64_t ends = 0, spaces = 0, specials = 0;
+        for (size_t i = 0; i < STRUCTURE_BLOCK_SIZE; i++) {
+                uint64_t bit = (uint64_t)1 << i;
+                if (p[i] == '\0' || p[i] == '\n')
+                        ends |= bit;
+                if (p[i] == ' ')
+                        spaces |= bit;
+                if (is_special(p[i]))
+                        specials |= bit;
+        }
+        *block = (struct structure_block){ ends, spaces, specials };
+}
+
+// NOTE Each variant indexes whole blocks in place and the last, partial,
+// block from a copy padded with NULs.
+#define INDEX(index_block) do { \
+        struct structure_block *b = blocks; \
+        for (; end - p >= STRUCTURE_BLOCK_SIZE; p += STRUCTURE_BLOCK_SIZE) \
+                index_block(b++, (const unsigned char *)p); \
+        unsigned char last[STRUCTURE_BLOCK_SIZE] = { 0 }; \
+        memcpy(last, p, (size_t)(end - p)); \
+        index_block(b, last); \
+} while (0)
+
+void
+structure_index_scalar(struct structure_block *blocks, const char *p,
+                       const char *end)
+{
+        INDEX(index_block_scalar);
+}
+
+#ifdef HAVE_SSE2
+static inline uint64_t
+sse2_mask(__m128i m, size_t i)
+{
+        return (uint64_t)(unsigned int)_mm_movemask_epi8(m) << (16 * i);
+}
+
+static inline void
+index_block_sse2(struct structure_block *block, const unsigned char *p)
+{
+        uint64_t ends = 0, spaces = 0, specials = 0;
+        for (size_t i = 0; i < STRUCTURE_BLOCK_SIZE / 16; i++) {
+                __m128i v = _mm_loadu_si128((const __m128i *)p + i);
+#define EQ(c) _mm_cmpeq_epi8(v, _mm_set1_epi8(c))
+                __m128i e = _mm_or_si128(EQ('\0'), EQ('\n'));
+                __m128i s = EQ(' ');
+                // NOTE ‘{’, ‘|’, and ‘}’ are 0x7b to 0x7d, the only bytes
+                // that, less ‘{’, are at most 2, unsigned.
+                __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('{'));
+                __m128i b = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(2)), d);
+                __m128i x = _mm_or_si128(_mm_or_si128(e, s), _mm_or_si128(b, EQ('/')));
+#undef EQ
+                ends |= sse2_mask(e, i);
+                spaces |= sse2_mask(s, i);
+                specials |= sse2_mask(_mm_or_si128(x, v), i);
+        }
+        *block = (struct structure_block){ ends, spaces, specials };
+}
+
+void
+structure_index_sse2(struct structure_block *blocks, const char *p,
+                     const char *end)
+{
+        INDEX(index_block_sse2);
+}
+#endif
+
+#ifdef HAVE_AVX2
+#define AVX2 __attribute__((target("avx2")))
+
+static inline AVX2 uint64_t
+avx2_mask(__m256i m, size_t i)
+{
+        return (uint64_t)(uint32_t)_mm256_movemask_epi8(m) << (32 * i);
+}
+
+static inline AVX2 void
+index_block_avx2(struct structure_block *block, const unsigned char *p)
+{
+        uint64_t ends = 0, spaces = 0, specials = 0;
+        for (size_t i = 0; i < STRUCTURE_BLOCK_SIZE / 32; i++) {
+                __m256i v = _mm256_loadu_si256((const __m256i *)p + i);
+#define EQ(c) _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))
+                __m256i e = _mm256_or_si256(EQ('\0'), EQ('\n'));
+                __m256i s = EQ(' ');
+                __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('{'));
+                __m256i b = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(2)), d);
+                __m256i x = _mm256_or_si256(_mm256_or_si256(e, s),
+                                            _mm256_or_si256(b, EQ('/')));
+#undef EQ
+                ends |= avx2_mask(e, i);
+                spaces |= avx2_mask(s, i);
+                specials |= avx2_mask(_mm256_or_si256(x, v), i);
+        }
+        *block = (struct structure_block){ ends, spaces, specials };
+}
+
+AVX2 void
+structure_index_avx2(struct structure_block *blocks, const char *p,
+                     const char *end)
+{
+        INDEX(index_block_avx2);
+}
+
+#undef AVX2
+#endif
+
+#undef INDEX
+
+void
+structure_index(struct structure_block *blocks, const char *p,
+                const char *end)
+{
+#ifdef HAVE_AVX2
+        if (__builtin_cpu_supports("avx2")) {
+                structure_index_avx2(blocks, p, end);
+                return;
+        }
+#endif
+#ifdef HAVE_SSE2
+        structure_index_sse2(blocks, p, end);
+#else
+        structure_index_scalar(blocks, p, end);
+#endif
+}
+
+static inline size_t
+blocks_of(const struct structure *structure, const char *p)
+{
+        return (size_t)(p - structure->input) / STRUCTURE_BLOCK_SIZE;
+}
+
+static void
+unindexed(struct structure *structure)
+{
+        free(structure->blocks);
+        structure->blocks = NULL;
+        structure->base = structure->limit = structure->input;
+        structure->n = 0;
+}
+
+// NOTE Moves the window to begin at block first.  The blocks that the old
+// window shares with the new one are moved rather than indexed again.
+static void
+window_at(struct structure *structure, size_t first)
+{
+        size_t total = blocks_of(structure, structure->end) + 1;
+        size_t n = total - first < structure->window ? total - first : structure->window;
+        size_t old = blocks_of(structure, structure->base);
+        size_t kept = 0;
+        if (old <= first && first < old + structure->n) {
+                kept = old + structure->n - first;
+                if (kept > n)
+                        kept = n;
+                memmove(structure->blocks, structure->blocks + (first - old),
+                        kept * sizeof(*structure->blocks));
+        }
+        const char *limit = first + n == total ? structure->end :
+                structure->input + (first + n) * STRUCTURE_BLOCK_SIZE;
+        if (kept < n)
+                structure_index(structure->blocks + kept,
+                                structure->input + (first + kept) * STRUCTURE_BLOCK_SIZE,
+                                limit);
+        if (limit < structure->end)
+                structure->blocks[n] = (struct structure_block){
+                        ~(uint64_t)0, 0, ~(uint64_t)0
+                };
+        structure->base = structure->input + first * STRUCTURE_BLOCK_SIZE;
+        structure->limit = limit;
+        structure->n = n;
+}
+
+// NOTE Moves the window so that p is in it, leaving half of it behind p,
+// as the lexer looks ahead and then backs up, but not so far that the
+// window ends before the input does.
+static void
+slide(struct structure *structure, const char *p)
+{
+        size_t total = blocks_of(structure, structure->end) + 1;
+        size_t first = blocks_of(structure, p);
+        first = first > structure->window / 2 ? first - structure->window / 2 : 0;
+        if (first + structure->window > total)
+                first = total > structure->window ? total - structure->window : 0;
+        window_at(structure, first);
+}
+
+static bool
+reserve(struct structure *structure)
+{
+        size_t total = blocks_of(structure, structure->end) + 1;
+        size_t size = (total < structure->window ? total : structure->window) + 1;
+        if (size <= structure->size)
+                return true;
+        if (size < 2 * structure->size)
+                size = 2 * structure->size < structure->window + 1 ?
+                        2 * structure->size : structure->window + 1;
+        struct structure_block *blocks =
+                realloc(structure->blocks, size * sizeof(*blocks));
+        if (blocks == NULL)
+                return false;
+        structure->blocks = blocks;
+        structure->size = size;
+        return true;
+}
+
+bool
+structure_init(struct structure *structure, const char *input,
+               const char *end, size_t window)
+{
+        structure->input = input;
+        structure->end = end;
+        structure->base = structure->limit = input;
+        structure->blocks = NULL;
+        structure->n = 0;
+        structure->window = window;
+        structure->size = 0;
+        if (!reserve(structure))
+                return false;
+        slide(structure, input);
+        return true;
+}
+
+// NOTE Takes note of what has been appended to the input, which may have
+// moved.  If the window held the old end, it’s indexed again from the
+// block that held it on, as that one was padded.
+bool
+structure_extend(struct structure *structure, const char *input,
+                 const char *end)
+{
+        bool reached = structure->limit == structure->end;
+        size_t first = blocks_of(structure, structure->base);
+        size_t k = blocks_of(structure, structure->end);
+        structure->limit = input + (structure->limit - structure->input);
+        structure->base = input + first * STRUCTURE_BLOCK_SIZE;
+        structure->input = input;
+        structure->end = end;
+        if (structure->blocks == NULL) {
+                structure->base = structure->limit = input;
+                return false;
+        }
+        if (!reserve(structure)) {
+                unindexed(structure);
+                return false;
+        }
+        if (reached) {
+                structure->n = k - first;
+                window_at(structure, first);
+        }
+        return true;
+}
+
+void
+structure_release(struct structure *structure)
+{
+        free(structure->blocks);
+}
+
+static inline bool
+is_in(unsigned char c, unsigned int which)
+{
+        return ((which & STRUCTURE_ENDS) && (c == '\0' || c == '\n')) ||
+                ((which & STRUCTURE_SPACES) && c == ' ') ||
+                ((which & STRUCTURE_NONSPACES) && c != ' ') ||
+                ((which & STRUCTURE_SPECIALS) && is_special(c));
+}
+
+const char *
+structure_find_scalar(const struct structure *structure, const char *p,
+                      unsigned int which)
+{
+        while (p < structure->end && !is_in((unsigned char)*p, which))
+                p++;
+        return p;
+}
+
+const char *
+structure_find_slow(struct structure *structure, const char *p,
+                    unsigned int which)
+{
+        if (structure->blocks == NULL)
+                return structure_find_scalar(structure, p, which);
+        while (p < structure->end) {
+                if (!(structure->base <= p && p < structure->limit))
+                        slide(structure, p);
+                const char *q = structure_find_window(structure, p, which);
+                if (q < structure->limit)
+                        return q;
+                p = structure->limit;
+        }
+        return p;
+}
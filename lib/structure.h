@@ -0,0 +1,111 @@
+// NOTE For each 64-byte block of the input, which bytes end a line (LF or
+// NUL), which are spaces, and which are specials, that is, ends, spaces,
+// the ASCII inline symbols, and the bytes of multibyte characters.  The
+// lexer uses it to jump to the next byte that it needs to look at.  The
+// last block always contains end, and every byte from end on counts as a
+// NUL.
+struct structure_block {
+        uint64_t ends;
+        uint64_t spaces;
+        uint64_t specials;
+};
+
+#define STRUCTURE_BLOCK_SIZE 64
+
+void structure_index_scalar(struct structure_block *blocks, const char *p,
+                            const char *end);
+#ifdef HAVE_SSE2
+void structure_index_sse2(struct structure_block *blocks, const char *p,
+                          const char *end);
+#endif
+#ifdef HAVE_AVX2
+void structure_index_avx2(struct structure_block *blocks, const char *p,
+                          const char *end);
+#endif
+
+void structure_index(struct structure_block *blocks, const char *p,
+                     const char *end);
+
+// NOTE The index covers a window of at most window blocks of the input,
+// from base to limit, which slides along as the lexer moves through it, so
+// that its size doesn’t depend on that of the input.  Unless the window
+// reaches the end, the block after its last one is all NULs, which stops
+// searches at its end.  Without memory for the index, base and limit are
+// both the beginning of the input.
+struct structure {
+        const char *input;
+        const char *end;
+        const char *base;
+        const char *limit;
+        struct structure_block *blocks;
+        size_t n;
+        size_t window;
+        size_t size;
+};
+
+#define STRUCTURE_WINDOW 4096
+
+bool structure_init(struct structure *structure, const char *input,
+                    const char *end, size_t window);
+bool structure_extend(struct structure *structure, const char *input,
+                      const char *end);
+void structure_release(struct structure *structure);
+
+enum structure_bits {
+        STRUCTURE_ENDS = 1 << 0,
+        STRUCTURE_SPACES = 1 << 1,
+        STRUCTURE_NONSPACES = 1 << 2,
+        STRUCTURE_SPECIALS = 1 << 3,
+};
+
+PURE const char *structure_find_scalar(const struct structure *structure,
+                                       const char *p, unsigned int which);
+const char *structure_find_slow(struct structure *structure, const char *p,
+                                unsigned int which);
+
+static inline uint64_t
+structure_bits(const struct structure_block *block, unsigned int which)
+{
+        return ((which & STRUCTURE_ENDS) ? block->ends : 0) |
+                ((which & STRUCTURE_SPACES) ? block->spaces : 0) |
+                ((which & STRUCTURE_NONSPACES) ? ~block->spaces : 0) |
+                ((which & STRUCTURE_SPECIALS) ? block->specials : 0);
+}
+
+// NOTE Returns the first byte at or after p, which must be in the window,
+// that is in any of the sets in which, or limit or later if there is none
+// in the window.
+static PURE inline const char *
+structure_find_window(const struct structure *structure, const char *p,
+                      unsigned int which)
+{
+        size_t i = (size_t)(p - structure->base);
+        size_t k = i / STRUCTURE_BLOCK_SIZE;
+        uint64_t m = structure_bits(&structure->blocks[k], which) &
+                (~(uint64_t)0 << (i % STRUCTURE_BLOCK_SIZE));
+        while (m == 0)
+                m = structure_bits(&structure->blocks[++k], which);
+        return structure->base + k * STRUCTURE_BLOCK_SIZE + __builtin_ctzll(m);
+}
+
+// NOTE Returns the first byte at or after p that is in any of the sets in
+// which, or end, if there is none before it and p isn’t past it.  The
+// search relies on the bytes past end to stop it, so which must include
+// ends, non-spaces, or specials.  Searches that leave the window slide it
+// along, and without an index, for want of memory, the bytes are looked at
+// one by one.
+static inline const char *
+structure_find(struct structure *structure, const char *p, unsigned int which)
+{
+        if (p >= structure->end)
+                return p;
+        if (LIKELY(structure->base <= p && p < structure->limit)) {
+                const char *q = structure_find_window(structure, p, which);
+                if (LIKELY(q < structure->limit))
+                        return q;
+                if (structure->limit == structure->end)
+                        return structure->end;
+                p = structure->limit;
+        }
+        return structure_find_slow(structure, p, which);
+}
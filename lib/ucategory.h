@@ -1,15487 +0,0 @@
-enum unicode_category {
-	UNICODE_OTHER_CONTROL,
-	UNICODE_OTHER_FORMAT,
-	UNICODE_OTHER_NOT_ASSIGNED,
-	UNICODE_OTHER_PRIVATE_USE,
-	UNICODE_OTHER_SURROGATE,
-	UNICODE_LETTER_LOWERCASE,
-	UNICODE_LETTER_MODIFIER,
-	UNICODE_LETTER_OTHER,
-	UNICODE_LETTER_TITLECASE,
-	UNICODE_LETTER_UPPERCASE,
-	UNICODE_MARK_SPACING_COMBINING,
-	UNICODE_MARK_ENCLOSING,
-	UNICODE_MARK_NONSPACING,
-	UNICODE_NUMBER_DECIMAL_DIGIT,
-	UNICODE_NUMBER_LETTER,
-	UNICODE_NUMBER_OTHER,
-	UNICODE_PUNCTUATION_CONNECTOR,
-	UNICODE_PUNCTUATION_DASH,
-	UNICODE_PUNCTUATION_CLOSE,
-	UNICODE_PUNCTUATION_FINAL_QUOTE,
-	UNICODE_PUNCTUATION_INITIAL_QUOTE,
-	UNICODE_PUNCTUATION_OTHER,
-	UNICODE_PUNCTUATION_OPEN,
-	UNICODE_SYMBOL_CURRENCY,
-	UNICODE_SYMBOL_MODIFIER,
-	UNICODE_SYMBOL_MATH,
-	UNICODE_SYMBOL_OTHER,
-	UNICODE_SEPARATOR_LINE,
-	UNICODE_SEPARATOR_PARAGRAPH,
-	UNICODE_SEPARATOR_SPACE,
-};
-
-static const int8_t category_data[][256] = {
-	{ // page 0, index 0
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_SEPARATOR_SPACE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MATH, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_OTHER_CONTROL, UNICODE_OTHER_CONTROL,
-		UNICODE_SEPARATOR_SPACE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_INITIAL_QUOTE,
-		UNICODE_SYMBOL_MATH, UNICODE_OTHER_FORMAT,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_NUMBER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 1, index 1
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 2, index 2
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-	},
-	{ // page 3, index 3
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_SYMBOL_MATH, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-	},
-	{ // page 4, index 4
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_ENCLOSING,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 5, index 5
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_DASH, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 6, index 6
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_FORMAT,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 7, index 7
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_FORMAT,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_SYMBOL_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 8, index 8
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 9, index 9
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 10, index 10
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 11, index 11
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 12, index 12
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 13, index 13
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 14, index 14
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_MODIFIER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 15, index 15
-		UNICODE_LETTER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 16, index 16
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 18, index 17
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 19, index 18
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 20, index 19
-		UNICODE_PUNCTUATION_DASH, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 22, index 20
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_SEPARATOR_SPACE, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 23, index 21
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 24, index 22
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SEPARATOR_SPACE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 25, index 23
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-	},
-	{ // page 26, index 24
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 27, index 25
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-	},
-	{ // page 28, index 26
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 29, index 27
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-	},
-	{ // page 30, index 28
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 31, index 29
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_LETTER_TITLECASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_TITLECASE, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 32, index 30
-		UNICODE_SEPARATOR_SPACE, UNICODE_SEPARATOR_SPACE,
-		UNICODE_SEPARATOR_SPACE, UNICODE_SEPARATOR_SPACE,
-		UNICODE_SEPARATOR_SPACE, UNICODE_SEPARATOR_SPACE,
-		UNICODE_SEPARATOR_SPACE, UNICODE_SEPARATOR_SPACE,
-		UNICODE_SEPARATOR_SPACE, UNICODE_SEPARATOR_SPACE,
-		UNICODE_SEPARATOR_SPACE, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_INITIAL_QUOTE,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_INITIAL_QUOTE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SEPARATOR_LINE, UNICODE_SEPARATOR_PARAGRAPH,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_SEPARATOR_SPACE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_INITIAL_QUOTE,
-		UNICODE_PUNCTUATION_FINAL_QUOTE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_PUNCTUATION_CONNECTOR, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_CONNECTOR, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SEPARATOR_SPACE,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_NUMBER_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_LETTER_MODIFIER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_ENCLOSING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_ENCLOSING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_ENCLOSING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 33, index 31
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-	},
-	{ // page 35, index 32
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 36, index 33
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-	},
-	{ // page 37, index 34
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-	},
-	{ // page 38, index 35
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-	},
-	{ // page 39, index 36
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-	},
-	{ // page 41, index 37
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-	},
-	{ // page 43, index 38
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 44, index 39
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-	},
-	{ // page 45, index 40
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-	},
-	{ // page 46, index 41
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_INITIAL_QUOTE,
-		UNICODE_PUNCTUATION_FINAL_QUOTE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_PUNCTUATION_FINAL_QUOTE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_DASH,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 47, index 42
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 48, index 43
-		UNICODE_SEPARATOR_SPACE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_NUMBER_LETTER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_OTHER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_PUNCTUATION_DASH, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 49, index 44
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 50, index 45
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 77, index 46
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-	},
-	{ // page 159, index 47
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 160, index 48
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 164, index 49
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-	},
-	{ // page 166, index 50
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_ENCLOSING, UNICODE_MARK_ENCLOSING,
-		UNICODE_MARK_ENCLOSING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 167, index 51
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 168, index 52
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 169, index 53
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_MODIFIER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 170, index 54
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 171, index 55
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 215, index 56
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 250, index 57
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 251, index 58
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 253, index 59
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 254, index 60
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_PUNCTUATION_CONNECTOR, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_PUNCTUATION_CONNECTOR, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_DASH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_DASH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_FORMAT,
-	},
-	{ // page 255, index 61
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_DASH,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_PUNCTUATION_CONNECTOR,
-		UNICODE_SYMBOL_MODIFIER, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_SYMBOL_MATH, UNICODE_PUNCTUATION_OPEN,
-		UNICODE_PUNCTUATION_CLOSE, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OPEN, UNICODE_PUNCTUATION_CLOSE,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MODIFIER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_CURRENCY,
-		UNICODE_SYMBOL_CURRENCY, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 256, index 62
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 257, index 63
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 258, index 64
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 259, index 65
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_NUMBER_LETTER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_LETTER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 260, index 66
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 264, index 67
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 265, index 68
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 266, index 69
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 267, index 70
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 268, index 71
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 270, index 72
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 272, index 73
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_FORMAT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 273, index 74
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 278, index 75
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 291, index 76
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 292, index 77
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_NUMBER_LETTER,
-		UNICODE_NUMBER_LETTER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_PUNCTUATION_OTHER, UNICODE_PUNCTUATION_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 308, index 78
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 362, index 79
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 367, index 80
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_LETTER_MODIFIER, UNICODE_LETTER_MODIFIER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 432, index 81
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 464, index 82
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 465, index 83
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_MARK_SPACING_COMBINING,
-		UNICODE_MARK_SPACING_COMBINING, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 466, index 84
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 467, index 85
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 468, index 86
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 469, index 87
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 470, index 88
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-	},
-	{ // page 471, index 89
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_UPPERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_SYMBOL_MATH,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_LOWERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_LETTER_UPPERCASE, UNICODE_LETTER_LOWERCASE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-		UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_NUMBER_DECIMAL_DIGIT,
-	},
-	{ // page 494, index 90
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_MATH, UNICODE_SYMBOL_MATH,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 496, index 91
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 497, index 92
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_NUMBER_OTHER,
-		UNICODE_NUMBER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-	},
-	{ // page 498, index 93
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 499, index 94
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 500, index 95
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 501, index 96
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-	},
-	{ // page 502, index 97
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 503, index 98
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_SYMBOL_OTHER, UNICODE_SYMBOL_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 678, index 99
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 695, index 100
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-	},
-	{ // page 696, index 101
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 762, index 102
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_LETTER_OTHER, UNICODE_LETTER_OTHER,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 3584, index 103
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_FORMAT, UNICODE_OTHER_FORMAT,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 3585, index 104
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_MARK_NONSPACING, UNICODE_MARK_NONSPACING,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 4095, index 105
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-	{ // page 4351, index 106
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_PRIVATE_USE, UNICODE_OTHER_PRIVATE_USE,
-		UNICODE_OTHER_NOT_ASSIGNED, UNICODE_OTHER_NOT_ASSIGNED,
-	},
-};
-
-#define UNICODE_LAST_CHAR_CATEGORY_PART_1 ((uchar)0x2faff)
-#define UNICODE_CATEGORY_DATA_MAX_INDEX ((uint8_t)107)
-
-// U+0000 through U+2FAFF
-static const uint8_t category_pages_part_1[] = {
-	0, // page 0
-	1, // page 1
-	2, // page 2
-	3, // page 3
-	4, // page 4
-	5, // page 5
-	6, // page 6
-	7, // page 7
-	8, // page 8
-	9, // page 9
-	10, // page 10
-	11, // page 11
-	12, // page 12
-	13, // page 13
-	14, // page 14
-	15, // page 15
-	16, // page 16
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	17, // page 18
-	18, // page 19
-	19, // page 20
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	20, // page 22
-	21, // page 23
-	22, // page 24
-	23, // page 25
-	24, // page 26
-	25, // page 27
-	26, // page 28
-	27, // page 29
-	28, // page 30
-	29, // page 31
-	30, // page 32
-	31, // page 33
-	UNICODE_SYMBOL_MATH + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	32, // page 35
-	33, // page 36
-	34, // page 37
-	35, // page 38
-	36, // page 39
-	UNICODE_SYMBOL_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	37, // page 41
-	UNICODE_SYMBOL_MATH + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	38, // page 43
-	39, // page 44
-	40, // page 45
-	41, // page 46
-	42, // page 47
-	43, // page 48
-	44, // page 49
-	45, // page 50
-	UNICODE_SYMBOL_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	46, // page 77
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	47, // page 159
-	48, // page 160
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	49, // page 164
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	50, // page 166
-	51, // page 167
-	52, // page 168
-	53, // page 169
-	54, // page 170
-	55, // page 171
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	56, // page 215
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_SURROGATE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	57, // page 250
-	58, // page 251
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	59, // page 253
-	60, // page 254
-	61, // page 255
-	62, // page 256
-	63, // page 257
-	64, // page 258
-	65, // page 259
-	66, // page 260
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	67, // page 264
-	68, // page 265
-	69, // page 266
-	70, // page 267
-	71, // page 268
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	72, // page 270
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	73, // page 272
-	74, // page 273
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	75, // page 278
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	76, // page 291
-	77, // page 292
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	78, // page 308
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	79, // page 362
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	80, // page 367
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	81, // page 432
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	82, // page 464
-	83, // page 465
-	84, // page 466
-	85, // page 467
-	86, // page 468
-	87, // page 469
-	88, // page 470
-	89, // page 471
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	90, // page 494
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	91, // page 496
-	92, // page 497
-	93, // page 498
-	94, // page 499
-	95, // page 500
-	96, // page 501
-	97, // page 502
-	98, // page 503
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	99, // page 678
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	100, // page 695
-	101, // page 696
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_LETTER_OTHER + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	102, // page 762
-};
-
-// U+E0000 through U+10FFFF
-static const uint8_t category_pages_part_2[] = {
-	103, // page 3584
-	104, // page 3585
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_NOT_ASSIGNED + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	105, // page 4095
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	UNICODE_OTHER_PRIVATE_USE + UNICODE_CATEGORY_DATA_MAX_INDEX,
-	106, // page 4351
-};
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <private.h>
 
@@ -12,79 +13,32 @@
 
 #define UNICODE_LAST_CHAR 0x10ffff
 
-#include "ucategory.h"
-#include "uwordbreak.h"
+#include "uproperties.h"
 
-#define UNICODE_FIRST_CHAR_PART_2 0xe0000
-
-struct uchar_interval {
-  uchar first;
-  uchar last;
-};
-
-#include "uwide.h"
-
-#define IS(type, class) (((unsigned int)1 << (type)) & (class))
-#define OR(type, rest)  (((unsigned int)1 << (type)) | (rest))
-
-static inline int
-lookup(uchar c, uchar last, uchar missing, uint8_t max, const uint8_t part_1[], const uint8_t part_2[], const int8_t data[][256])
-{
-        int16_t index;
-
-	if (c <= last)
-                index = part_1[c >> 8];
-        else if (UNICODE_FIRST_CHAR_PART_2 <= c && c <= UNICODE_LAST_CHAR)
-                index = part_2[(c - UNICODE_FIRST_CHAR_PART_2) >> 8];
-	else
-		return missing;
-
-	if (index >= max)
-		return index - max;
-
-        return data[index][c & 0xff];
-}
-
-static inline int
-s_type(uchar c)
+// NOTE Every property the lexer asks about is found with a single lookup in
+// a two-level table generated by build/uproperties: the block that a code
+// point belongs to is found in property_index and its entry in that block
+// gives its set of properties in property_leaves.
+static inline uint16_t
+s_properties(uchar c)
 {
-        return lookup(c,
-                      UNICODE_LAST_CHAR_CATEGORY_PART_1,
-                      UNICODE_OTHER_NOT_ASSIGNED,
-                      UNICODE_CATEGORY_DATA_MAX_INDEX,
-                      category_pages_part_1,
-                      category_pages_part_2,
-                      category_data);
+        if (UNLIKELY((uint32_t)c > UNICODE_LAST_CHAR))
+                return property_leaves[UNICODE_PROPERTY_MISSING];
+        return property_leaves[property_blocks[property_index[c >> UNICODE_PROPERTY_BLOCK_SHIFT]]
+                               [c & ((1 << UNICODE_PROPERTY_BLOCK_SHIFT) - 1)]];
 }
 
 bool
 uc_issolid(uchar c)
 {
         // TODO We should really check the combining class of c as well.
-        return !IS(s_type(c),
-                   OR(UNICODE_OTHER_CONTROL,
-                      OR(UNICODE_OTHER_FORMAT,
-                         OR(UNICODE_OTHER_SURROGATE,
-                            OR(UNICODE_OTHER_PRIVATE_USE,
-                               OR(UNICODE_OTHER_NOT_ASSIGNED,
-                                  OR(UNICODE_MARK_SPACING_COMBINING,
-                                     OR(UNICODE_MARK_ENCLOSING,
-                                        OR(UNICODE_MARK_NONSPACING,
-                                           OR(UNICODE_SEPARATOR_LINE,
-                                              OR(UNICODE_SEPARATOR_PARAGRAPH,
-                                                 OR(UNICODE_SEPARATOR_SPACE, 0))))))))))));
+        return s_properties(c) & UNICODE_PROPERTY_SOLID;
 }
 
-static inline int
+static inline enum unicode_word_break
 s_word_break(uchar c)
 {
-        return lookup(c,
-                      UNICODE_LAST_CHAR_WORD_BREAK_PART_1,
-                      UNICODE_WORD_BREAK_OTHER,
-                      UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-                      word_break_pages_part_1,
-                      word_break_pages_part_2,
-                      word_break_data);
+        return UNICODE_PROPERTY_WORD_BREAK(s_properties(c));
 }
 
 bool
@@ -123,12 +77,13 @@ u_prev_s(const char *string, const char *p)
 bool
 u_isafteraletterornumeric(const char *string, const char *p)
 {
+        const char *end = p;
         while (p >= string) {
         next:
                 p = u_prev_s(string, p);
                 if (p == NULL)
                         return false;
-                uchar c = u_dref(p);
+                uchar c = u_dref(p, end);
                 switch (c) {
                 case ':':
                 case '/':
@@ -199,7 +154,7 @@ u_word_breaks(const char *string, size_t n, bool *breaks)
         uint8_t state = 2;
         while (p < end) {
                 size_t l;
-                state = wb_dfa[state & 0xf][s_word_break(u_lref(p, &l))];
+                state = wb_dfa[state & 0xf][s_word_break(u_decode(p, end, &l))];
                 switch (state >> 4) {
                 case 1:
                         *q = false;
@@ -220,56 +175,40 @@ u_word_breaks(const char *string, size_t n, bool *breaks)
         }
 }
 
-static int
-uchar_interval_compare(const void *key, const void *element)
-{
-        uchar c = *(uchar *)key;
-        struct uchar_interval *interval = (struct uchar_interval *)element;
-        if (c < interval->first)
-                return -1;
-        else if (c > interval->last)
-                return +1;
-        else
-                return 0;
-}
-
-static inline bool
-uc_iswide(uchar c)
-{
-        return bsearch(&c, wide, lengthof(wide), sizeof(wide[0]),
-                       uchar_interval_compare) != NULL;
-}
-
-#define SOFT_HYPHEN ((uchar)0x00ad)
-#define ZERO_WIDTH_SPACE ((uchar)0x200b)
-
-static inline bool
-uc_iszerowidth(uchar c)
-{
-        if (UNLIKELY(c == SOFT_HYPHEN))
-                return false;
-        if (UNLIKELY(IS(s_type(c),
-                        OR(UNICODE_MARK_NONSPACING,
-                           OR(UNICODE_MARK_ENCLOSING,
-                              OR(UNICODE_OTHER_FORMAT, 0))))))
-                return true;
-        if (UNLIKELY((0x1160 <= c && c < 0x1200) || c == ZERO_WIDTH_SPACE))
-                return true;
-        return false;
-}
-
 static inline int
 uc_width(uchar c)
 {
-        return uc_iswide(c) ? 2 : uc_iszerowidth(c) ? 0 : 1;
+        return UNICODE_PROPERTY_WIDTH(s_properties(c));
 }
 
+#define ASCII_MASK UINT64_C(0x8080808080808080)
+
+// NOTE Every ASCII character, control characters included, is one column
+// wide, so runs of them are counted eight bytes at a time without being
+// decoded.
 size_t
 u_width(const char *string, size_t length)
 {
 	size_t w = 0, n;
-        for (const char *p = string, *end = p + length; p < end; p += n)
-                w += uc_width(u_lref(p, &n));
+        const char *p = string, *end = p + length;
+        while (p < end) {
+                uint64_t word;
+                if ((size_t)(end - p) >= sizeof(word)) {
+                        memcpy(&word, p, sizeof(word));
+                        if ((word & ASCII_MASK) == 0) {
+                                w += sizeof(word);
+                                p += sizeof(word);
+                                continue;
+                        }
+                }
+                if (*(const unsigned char *)p < 0x80) {
+                        w++;
+                        p++;
+                        continue;
+                }
+                w += uc_width(u_decode(p, end, &n));
+                p += n;
+        }
 	return w;
 }
 
@@ -312,20 +251,6 @@ decode(uchar *state, uchar *c, uchar b)
         return *state;
 }
 
-uchar
-u_dref(const char *u)
-{
-        uchar c = 0, state = ACCEPT;
-        for (const unsigned char *p = (const unsigned char *)u; *p != '\0'; p++)
-                switch (decode(&state, &c, *p)) {
-                case ACCEPT:
-                        return c;
-                case REJECT:
-                        return U_BAD_INPUT_CHAR;
-                }
-        return *u == '\0' ? '\0' : U_BAD_INPUT_CHAR;
-}
-
 static const uint8_t s_u_skip_length_data[256] = {
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
@@ -338,3 +263,26 @@ static const uint8_t s_u_skip_length_data[256] = {
 };
 
 const char * const u_skip_lengths = (const char *)s_u_skip_length_data;
+
+uchar
+u_decode_multibyte(const char *u, const char *end, size_t *length)
+{
+        if (u >= end) {
+                *length = 0;
+                return '\0';
+        }
+        const unsigned char *p = (const unsigned char *)u;
+        size_t n = s_u_skip_length_data[*p];
+        if (n > (size_t)(end - u))
+                n = end - u;
+        *length = n;
+        uchar c = 0, state = ACCEPT;
+        for (size_t i = 0; i < n; i++)
+                switch (decode(&state, &c, p[i])) {
+                case ACCEPT:
+                        return c;
+                case REJECT:
+                        return U_BAD_INPUT_CHAR;
+                }
+        return U_BAD_INPUT_CHAR;
+}
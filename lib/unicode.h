@@ -13,26 +13,34 @@ size_t u_width(const char *string, size_t length);
 
 extern const char * const u_skip_lengths;
 
-#define u_next(p) ((p) + u_skip_lengths[*(const unsigned char *)(p)])
+static inline const char *
+u_next(const char *p, const char *end)
+{
+        size_t n = u_skip_lengths[*(const unsigned char *)p];
+        return n < (size_t)(end - p) ? p + n : end;
+}
+
 PURE char *u_prev_s(const char *string, const char *p);
 
-PURE uchar u_dref(const char *u);
+uchar u_decode_multibyte(const char *u, const char *end, size_t *length);
 
+// NOTE Decodes the character at u, never reading from end or beyond, and
+// sets *length to the number of bytes it takes up.  A broken sequence is
+// returned as U_BAD_INPUT_CHAR, with the length its first byte claims,
+// cut short at end.  At end, '\0' is returned with a length of 0.
 static inline uchar
-u_lref(const char *u, size_t *length)
+u_decode(const char *u, const char *end, size_t *length)
 {
-        uchar c = u_dref(u);
-        *length = u_next(u) - u;
-        return c;
+        if (LIKELY(u < end && *(const unsigned char *)u < 0x80)) {
+                *length = 1;
+                return *(const unsigned char *)u;
+        }
+        return u_decode_multibyte(u, end, length);
 }
 
 static inline uchar
-u_iref(const char *u, size_t *length)
+u_dref(const char *u, const char *end)
 {
-        if (*(const unsigned char *)u < 0x80) {
-                *length = 1;
-                return *u;
-        } else {
-                return u_lref(u, length);
-        }
+        size_t length;
+        return u_decode(u, end, &length);
 }
@@ -0,0 +1,3158 @@
+// NOTE Generated by build/uproperties.  82 distinct sets of properties
+// in 191 distinct blocks of 128 code points take up 33316 bytes.
+
+enum unicode_category {
+	UNICODE_OTHER_CONTROL,
+	UNICODE_OTHER_FORMAT,
+	UNICODE_OTHER_NOT_ASSIGNED,
+	UNICODE_OTHER_PRIVATE_USE,
+	UNICODE_OTHER_SURROGATE,
+	UNICODE_LETTER_LOWERCASE,
+	UNICODE_LETTER_MODIFIER,
+	UNICODE_LETTER_OTHER,
+	UNICODE_LETTER_TITLECASE,
+	UNICODE_LETTER_UPPERCASE,
+	UNICODE_MARK_SPACING_COMBINING,
+	UNICODE_MARK_ENCLOSING,
+	UNICODE_MARK_NONSPACING,
+	UNICODE_NUMBER_DECIMAL_DIGIT,
+	UNICODE_NUMBER_LETTER,
+	UNICODE_NUMBER_OTHER,
+	UNICODE_PUNCTUATION_CONNECTOR,
+	UNICODE_PUNCTUATION_DASH,
+	UNICODE_PUNCTUATION_CLOSE,
+	UNICODE_PUNCTUATION_FINAL_QUOTE,
+	UNICODE_PUNCTUATION_INITIAL_QUOTE,
+	UNICODE_PUNCTUATION_OTHER,
+	UNICODE_PUNCTUATION_OPEN,
+	UNICODE_SYMBOL_CURRENCY,
+	UNICODE_SYMBOL_MODIFIER,
+	UNICODE_SYMBOL_MATH,
+	UNICODE_SYMBOL_OTHER,
+	UNICODE_SEPARATOR_LINE,
+	UNICODE_SEPARATOR_PARAGRAPH,
+	UNICODE_SEPARATOR_SPACE,
+};
+
+enum unicode_word_break {
+	UNICODE_WORD_BREAK_ALETTER,
+	UNICODE_WORD_BREAK_CR,
+	UNICODE_WORD_BREAK_EXTEND,
+	UNICODE_WORD_BREAK_EXTENDNUMLET,
+	UNICODE_WORD_BREAK_FORMAT,
+	UNICODE_WORD_BREAK_KATAKANA,
+	UNICODE_WORD_BREAK_LF,
+	UNICODE_WORD_BREAK_MIDLETTER,
+	UNICODE_WORD_BREAK_MIDNUM,
+	UNICODE_WORD_BREAK_MIDNUMLET,
+	UNICODE_WORD_BREAK_NEWLINE,
+	UNICODE_WORD_BREAK_NUMERIC,
+	UNICODE_WORD_BREAK_OTHER,
+	UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
+};
+
+enum unicode_width {
+	UNICODE_WIDTH_ZERO,
+	UNICODE_WIDTH_NARROW,
+	UNICODE_WIDTH_WIDE,
+};
+
+#define UNICODE_PROPERTY_SOLID ((uint16_t)1 << 11)
+#define UNICODE_PROPERTY(category, word_break, width, solid) \
+	((uint16_t)((category) | (word_break) << 5 | (width) << 9 | \
+	            ((solid) ? UNICODE_PROPERTY_SOLID : 0)))
+#define UNICODE_PROPERTY_CATEGORY(p) ((enum unicode_category)((p) & 0x1f))
+#define UNICODE_PROPERTY_WORD_BREAK(p) ((enum unicode_word_break)((p) >> 5 & 0xf))
+#define UNICODE_PROPERTY_WIDTH(p) ((int)((p) >> 9 & 0x3))
+
+#define UNICODE_PROPERTY_BLOCK_SHIFT 7
+#define UNICODE_PROPERTY_MISSING ((uint8_t)28)
+
+static const uint16_t property_leaves[] = {
+	UNICODE_PROPERTY(UNICODE_OTHER_CONTROL, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_CONTROL, UNICODE_WORD_BREAK_LF, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_CONTROL, UNICODE_WORD_BREAK_NEWLINE, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_CONTROL, UNICODE_WORD_BREAK_CR, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_SEPARATOR_SPACE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_CURRENCY, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OPEN, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_CLOSE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MATH, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDNUM, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_DASH, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_WORD_BREAK_NUMERIC, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDLETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_UPPERCASE, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MODIFIER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_CONNECTOR, UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_LOWERCASE, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_OTHER_FORMAT, UNICODE_WORD_BREAK_FORMAT, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_NUMBER_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_FINAL_QUOTE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_TITLECASE, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_MARK_NONSPACING, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_ZERO, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_NOT_ASSIGNED, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_MARK_ENCLOSING, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_ZERO, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_OTHER_FORMAT, UNICODE_WORD_BREAK_FORMAT, UNICODE_WIDTH_ZERO, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_NUMERIC, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_MARK_SPACING_COMBINING, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_ZERO, true),
+	UNICODE_PROPERTY(UNICODE_NUMBER_LETTER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_OTHER_FORMAT, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_ZERO, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_FORMAT, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_ZERO, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_INITIAL_QUOTE, UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_FINAL_QUOTE, UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SEPARATOR_LINE, UNICODE_WORD_BREAK_NEWLINE, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_SEPARATOR_PARAGRAPH, UNICODE_WORD_BREAK_NEWLINE, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MATH, UNICODE_WORD_BREAK_MIDNUM, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OPEN, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_CLOSE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_OTHER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SEPARATOR_SPACE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_NUMBER_LETTER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_DASH, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_MARK_NONSPACING, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_WIDE, false),
+	UNICODE_PROPERTY(UNICODE_MARK_SPACING_COMBINING, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_WIDE, false),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MODIFIER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_DASH, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_NUMBER_OTHER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_OTHER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_OTHER_NOT_ASSIGNED, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_SURROGATE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_OTHER_PRIVATE_USE, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_NARROW, false),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDNUM, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDLETTER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_CONNECTOR, UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_PUNCTUATION_OTHER, UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MATH, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_CURRENCY, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_NUMBER_DECIMAL_DIGIT, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_UPPERCASE, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_MODIFIER, UNICODE_WORD_BREAK_OTHER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_LOWERCASE, UNICODE_WORD_BREAK_ALETTER, UNICODE_WIDTH_WIDE, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_OTHER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_KATAKANA, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_LETTER_MODIFIER, UNICODE_WORD_BREAK_EXTEND, UNICODE_WIDTH_NARROW, true),
+	UNICODE_PROPERTY(UNICODE_SYMBOL_OTHER, UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WIDTH_NARROW, true),
+};
+
+static const uint8_t property_blocks[][128] = {
+	{ // block 0
+		0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	1,	2,	2,	3,	0,	0,
+		0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,
+		4,	5,	5,	5,	6,	5,	5,	7,	8,	9,	5,	10,	11,	12,	7,	5,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	14,	11,	10,	10,	10,	5,
+		5,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	8,	5,	9,	16,	17,
+		16,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	8,	10,	9,	10,	0,
+	},
+	{ // block 1
+		0,	0,	0,	0,	0,	2,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,
+		0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,	0,
+		4,	5,	6,	6,	6,	6,	19,	5,	16,	19,	20,	21,	10,	22,	19,	16,
+		19,	10,	23,	23,	16,	18,	5,	14,	16,	23,	20,	24,	23,	23,	23,	5,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	10,	15,	15,	15,	15,	15,	15,	15,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	10,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 2
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	18,	15,	18,	15,	18,	15,	18,	15,
+		18,	15,	18,	15,	18,	15,	18,	15,	18,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	15,	18,	15,	18,	15,	18,	18,
+	},
+	{ // block 3
+		18,	15,	15,	18,	15,	18,	15,	15,	18,	15,	15,	15,	18,	18,	15,	15,
+		15,	15,	18,	15,	15,	18,	15,	15,	15,	18,	18,	18,	15,	15,	18,	15,
+		15,	18,	15,	18,	15,	18,	15,	15,	18,	15,	18,	18,	15,	18,	15,	15,
+		18,	15,	15,	15,	18,	15,	18,	15,	15,	18,	18,	20,	15,	18,	18,	18,
+		20,	20,	20,	20,	15,	25,	18,	15,	25,	18,	15,	25,	18,	15,	18,	15,
+		18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		18,	15,	25,	18,	15,	18,	15,	15,	15,	18,	15,	18,	15,	18,	15,	18,
+	},
+	{ // block 4
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	18,	18,	18,	18,	18,	18,	15,	15,	18,	15,	15,	18,
+		18,	15,	18,	15,	15,	15,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 5
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	20,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	16,	16,	16,	16,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,
+		26,	26,	26,	26,	26,	16,	16,	16,	16,	16,	16,	16,	26,	16,	26,	16,
+		16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,
+	},
+	{ // block 6
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		15,	18,	15,	18,	26,	16,	15,	18,	28,	28,	26,	18,	18,	18,	11,	28,
+	},
+	{ // block 7
+		28,	28,	28,	28,	16,	16,	15,	14,	15,	15,	15,	28,	15,	28,	15,	15,
+		18,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	28,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	15,
+		18,	18,	15,	15,	15,	18,	18,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		18,	18,	18,	18,	15,	18,	10,	15,	18,	15,	15,	18,	18,	15,	15,	15,
+	},
+	{ // block 8
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+	},
+	{ // block 9
+		15,	18,	19,	27,	27,	27,	27,	27,	29,	29,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+	},
+	{ // block 10
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	28,	28,	26,	5,	5,	5,	5,	5,	5,
+		28,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 11
+		18,	18,	18,	18,	18,	18,	18,	18,	28,	11,	12,	28,	28,	28,	28,	6,
+		28,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	12,	27,
+		5,	27,	27,	5,	27,	27,	5,	27,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,
+		20,	20,	20,	30,	14,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 12
+		31,	31,	31,	31,	31,	28,	10,	10,	10,	5,	5,	6,	11,	11,	19,	19,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	5,	28,	28,	5,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		26,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	5,	32,	11,	5,	20,	20,
+		27,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 13
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	5,	20,	27,	27,	27,	27,	27,	27,	27,	31,	19,	27,
+		27,	27,	27,	27,	27,	26,	26,	27,	27,	19,	27,	27,	27,	27,	20,	20,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	20,	19,	19,	20,
+	},
+	{ // block 14
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	28,	31,
+		20,	27,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	28,	28,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 15
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	26,	26,	19,	5,	11,	5,	26,	28,	28,	28,	28,	28,
+	},
+	{ // block 16
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	26,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	26,	27,	27,	27,	26,	27,	27,	27,	27,	27,	28,	28,
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	28,	28,	5,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 17
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	28,
+	},
+	{ // block 18
+		27,	27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	33,	27,	20,	33,	33,
+		33,	27,	27,	27,	27,	27,	27,	27,	27,	33,	33,	33,	33,	27,	33,	33,
+		20,	27,	27,	27,	27,	27,	27,	27,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	27,	27,	5,	5,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		5,	26,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 19
+		28,	27,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	20,
+		20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	28,	28,	28,	20,	20,	20,	20,	28,	28,	27,	20,	33,	33,
+		33,	27,	27,	27,	27,	28,	28,	33,	33,	28,	28,	33,	33,	27,	20,	28,
+		28,	28,	28,	28,	28,	28,	28,	33,	28,	28,	28,	28,	20,	20,	28,	20,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		20,	20,	6,	6,	23,	23,	23,	23,	23,	23,	19,	6,	28,	28,	28,	28,
+	},
+	{ // block 20
+		28,	27,	27,	33,	28,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	20,
+		20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	20,	28,	20,	20,	28,	20,	20,	28,	28,	27,	28,	33,	33,
+		33,	27,	27,	28,	28,	28,	28,	27,	27,	28,	28,	27,	27,	27,	28,	28,
+		28,	27,	28,	28,	28,	28,	28,	28,	28,	20,	20,	20,	20,	28,	20,	28,
+		28,	28,	28,	28,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		27,	27,	20,	20,	20,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 21
+		28,	27,	27,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,
+		20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	20,	28,	20,	20,	20,	20,	20,	28,	28,	27,	20,	33,	33,
+		33,	27,	27,	27,	27,	27,	28,	27,	27,	33,	28,	33,	33,	27,	28,	28,
+		20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		5,	6,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 22
+		28,	27,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	20,
+		20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	20,	28,	20,	20,	20,	20,	20,	28,	28,	27,	20,	33,	27,
+		33,	27,	27,	27,	27,	28,	28,	33,	33,	28,	28,	33,	33,	27,	28,	28,
+		28,	28,	28,	28,	28,	28,	27,	33,	28,	28,	28,	28,	20,	20,	28,	20,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		19,	20,	23,	23,	23,	23,	23,	23,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 23
+		28,	28,	27,	20,	28,	20,	20,	20,	20,	20,	20,	28,	28,	28,	20,	20,
+		20,	28,	20,	20,	20,	20,	28,	28,	28,	20,	20,	28,	20,	28,	20,	20,
+		28,	28,	28,	20,	20,	28,	28,	28,	20,	20,	20,	28,	28,	28,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	33,	33,
+		27,	33,	33,	28,	28,	28,	33,	33,	33,	28,	33,	33,	33,	27,	28,	28,
+		20,	28,	28,	28,	28,	28,	28,	33,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		23,	23,	23,	19,	19,	19,	19,	19,	19,	6,	19,	28,	28,	28,	28,	28,
+	},
+	{ // block 24
+		28,	33,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,
+		20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	28,	28,	28,	20,	27,	27,
+		27,	33,	33,	33,	33,	28,	27,	27,	27,	28,	27,	27,	27,	27,	28,	28,
+		28,	28,	28,	28,	28,	27,	27,	28,	20,	20,	28,	28,	28,	28,	28,	28,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		28,	28,	28,	28,	28,	28,	28,	28,	23,	23,	23,	23,	23,	23,	23,	19,
+	},
+	{ // block 25
+		28,	28,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,
+		20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	28,	28,	27,	20,	33,	27,
+		33,	33,	33,	33,	33,	28,	27,	33,	33,	28,	33,	33,	27,	27,	28,	28,
+		28,	28,	28,	28,	28,	33,	33,	28,	28,	28,	28,	28,	28,	28,	20,	28,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		28,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 26
+		28,	28,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,
+		20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	20,	33,	33,
+		33,	27,	27,	27,	27,	28,	33,	33,	33,	28,	33,	33,	33,	27,	20,	28,
+		28,	28,	28,	28,	28,	28,	28,	33,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	27,	27,	28,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		23,	23,	23,	23,	23,	23,	28,	28,	28,	19,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 27
+		28,	28,	33,	33,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	27,	28,	28,	28,	28,	33,
+		33,	33,	27,	27,	27,	28,	27,	28,	33,	33,	33,	33,	33,	33,	33,	33,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	33,	33,	5,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 28
+		28,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	27,	34,	34,	27,	27,	27,	27,	27,	27,	27,	28,	28,	28,	28,	6,
+		34,	34,	34,	34,	34,	34,	35,	27,	27,	27,	27,	27,	27,	27,	27,	5,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	5,	5,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 29
+		28,	34,	34,	28,	34,	28,	28,	34,	34,	28,	34,	28,	28,	34,	28,	28,
+		28,	28,	28,	28,	34,	34,	34,	34,	28,	34,	34,	34,	34,	34,	34,	34,
+		28,	34,	34,	34,	28,	34,	28,	34,	28,	28,	34,	34,	28,	34,	34,	34,
+		34,	27,	34,	34,	27,	27,	27,	27,	27,	27,	28,	27,	27,	34,	28,	28,
+		34,	34,	34,	34,	34,	28,	35,	28,	27,	27,	27,	27,	27,	27,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	34,	34,	34,	34,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 30
+		20,	19,	19,	19,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,
+		5,	5,	5,	19,	5,	19,	19,	19,	27,	27,	19,	19,	19,	19,	19,	19,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	19,	27,	19,	27,	19,	27,	8,	9,	8,	9,	33,	33,
+		20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,
+		28,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	33,
+	},
+	{ // block 31
+		27,	27,	27,	27,	27,	5,	27,	27,	20,	20,	20,	20,	20,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	28,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	28,	19,	19,
+		19,	19,	19,	19,	19,	19,	27,	19,	19,	19,	19,	19,	19,	28,	19,	19,
+		5,	5,	5,	5,	5,	19,	19,	19,	19,	5,	5,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 32
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	33,	33,	27,	27,	27,
+		27,	33,	27,	27,	27,	27,	27,	27,	33,	27,	27,	33,	33,	27,	27,	34,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	5,	5,	5,	5,	5,	5,
+		34,	34,	34,	34,	34,	34,	33,	33,	27,	27,	34,	34,	34,	34,	27,	27,
+		27,	34,	33,	33,	33,	34,	34,	33,	33,	33,	33,	33,	33,	33,	34,	34,
+		34,	27,	27,	27,	27,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+	},
+	{ // block 33
+		34,	34,	27,	33,	33,	27,	27,	33,	33,	33,	33,	33,	33,	27,	34,	33,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	33,	33,	33,	27,	19,	19,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	28,	15,	28,	28,	28,	28,	28,	15,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	5,	26,	20,	20,	20,
+	},
+	{ // block 34
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+	},
+	{ // block 35
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+		37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,	37,
+	},
+	{ // block 36
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	28,	20,	20,	20,	20,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 37
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	20,	20,	20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		20,	28,	20,	20,	20,	20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 38
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	28,	20,	20,	20,	20,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	27,	27,	27,
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	28,	28,	28,
+	},
+	{ // block 39
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 40
+		12,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 41
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 42
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	5,	5,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 43
+		4,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	8,	9,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	5,	5,	5,	38,	38,
+		38,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 44
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,
+		20,	20,	27,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	27,	27,	27,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,
+		20,	28,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 45
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	27,	27,	33,	27,	27,	27,	27,	27,	27,	27,	33,	33,
+		33,	33,	33,	33,	33,	33,	27,	33,	33,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	5,	5,	5,	35,	5,	5,	5,	6,	34,	27,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 46
+		5,	5,	5,	5,	5,	5,	12,	5,	5,	5,	5,	27,	27,	27,	4,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	26,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 47
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	20,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 48
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,
+		27,	27,	27,	33,	33,	33,	33,	27,	27,	33,	33,	33,	28,	28,	28,	28,
+		33,	33,	27,	33,	33,	33,	33,	33,	33,	27,	27,	27,	28,	28,	28,	28,
+		19,	28,	28,	28,	5,	5,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	28,	28,
+		34,	34,	34,	34,	34,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 49
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	28,	28,	28,	28,
+		33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,
+		33,	34,	34,	34,	34,	34,	34,	34,	33,	33,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	23,	28,	28,	28,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 50
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	27,	27,	33,	33,	33,	28,	28,	5,	5,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	33,	27,	33,	27,	27,	27,	27,	27,	27,	27,	28,
+		27,	33,	27,	33,	33,	27,	27,	27,	27,	27,	27,	27,	27,	33,	33,	33,
+		33,	33,	33,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	28,	28,	27,
+	},
+	{ // block 51
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		5,	5,	5,	5,	5,	5,	5,	35,	5,	5,	5,	5,	5,	5,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 52
+		27,	27,	27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	27,	33,	27,	27,	27,	27,	27,	33,	27,	33,	33,	33,
+		33,	33,	27,	33,	33,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	5,	5,	5,	5,	5,	5,
+		5,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,
+	},
+	{ // block 53
+		27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	33,	27,	27,	27,	27,	33,	33,	27,	27,	33,	27,	33,	33,	20,	20,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	27,	33,	27,	27,	33,	33,	33,	27,	33,	27,
+		27,	27,	33,	33,	28,	28,	28,	28,	28,	28,	28,	28,	5,	5,	5,	5,
+	},
+	{ // block 54
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	33,	33,	33,	33,	33,	33,	33,	33,	27,	27,	27,	27,
+		27,	27,	27,	27,	33,	33,	27,	27,	28,	28,	28,	5,	5,	5,	5,	5,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	20,	20,	20,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	26,	26,	26,	26,	26,	26,	5,	5,
+	},
+	{ // block 55
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		5,	5,	5,	5,	5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,
+		27,	27,	27,	5,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	33,	27,	27,	27,	27,	27,	27,	27,	20,	20,	20,	20,	27,	20,	20,
+		20,	20,	33,	33,	27,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 56
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	26,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 57
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	26,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	27,	27,	27,	27,
+	},
+	{ // block 58
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+	},
+	{ // block 59
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	18,	18,	18,	18,	18,	18,	18,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+	},
+	{ // block 60
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		18,	18,	18,	18,	18,	18,	28,	28,	15,	15,	15,	15,	15,	15,	28,	28,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		18,	18,	18,	18,	18,	18,	28,	28,	15,	15,	15,	15,	15,	15,	28,	28,
+		18,	18,	18,	18,	18,	18,	18,	18,	28,	15,	28,	15,	28,	15,	28,	15,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	28,	28,
+	},
+	{ // block 61
+		18,	18,	18,	18,	18,	18,	18,	18,	25,	25,	25,	25,	25,	25,	25,	25,
+		18,	18,	18,	18,	18,	18,	18,	18,	25,	25,	25,	25,	25,	25,	25,	25,
+		18,	18,	18,	18,	18,	18,	18,	18,	25,	25,	25,	25,	25,	25,	25,	25,
+		18,	18,	18,	18,	18,	28,	18,	18,	15,	15,	15,	15,	25,	16,	18,	16,
+		16,	16,	18,	18,	18,	28,	18,	18,	15,	15,	15,	15,	25,	16,	16,	16,
+		18,	18,	18,	18,	28,	28,	18,	18,	15,	15,	15,	15,	28,	16,	16,	16,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	16,	16,	16,
+		28,	28,	18,	18,	18,	28,	18,	18,	15,	15,	15,	15,	25,	16,	16,	28,
+	},
+	{ // block 62
+		4,	4,	4,	4,	4,	4,	4,	4,	4,	4,	4,	39,	40,	40,	31,	31,
+		12,	12,	12,	12,	12,	12,	5,	5,	41,	42,	8,	21,	21,	24,	8,	21,
+		5,	5,	5,	5,	7,	5,	5,	14,	43,	44,	31,	31,	31,	31,	31,	4,
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	21,	24,	5,	5,	5,	5,	17,
+		17,	5,	5,	5,	45,	8,	9,	5,	5,	5,	5,	5,	5,	5,	5,	5,
+		5,	5,	10,	5,	17,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	4,
+		31,	31,	31,	31,	31,	28,	28,	28,	28,	28,	31,	31,	31,	31,	31,	31,
+		23,	26,	28,	28,	23,	23,	23,	23,	23,	23,	10,	10,	10,	8,	9,	26,
+	},
+	{ // block 63
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	10,	10,	10,	8,	9,	28,
+		26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	28,	28,	28,
+		6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,
+		6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	6,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	29,	29,	29,
+		29,	27,	29,	29,	29,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 64
+		19,	19,	15,	19,	19,	19,	19,	15,	19,	19,	18,	15,	15,	15,	18,	18,
+		15,	15,	15,	18,	19,	15,	19,	19,	10,	15,	15,	15,	15,	15,	19,	19,
+		19,	19,	19,	19,	15,	19,	15,	19,	15,	19,	15,	15,	15,	15,	19,	18,
+		15,	15,	15,	15,	18,	20,	20,	20,	20,	18,	19,	19,	18,	18,	15,	15,
+		10,	10,	10,	10,	10,	15,	18,	18,	18,	18,	19,	10,	19,	19,	18,	19,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+	},
+	{ // block 65
+		38,	38,	38,	15,	18,	38,	38,	38,	38,	23,	28,	28,	28,	28,	28,	28,
+		10,	10,	10,	10,	10,	19,	19,	19,	19,	19,	10,	10,	19,	19,	19,	19,
+		10,	19,	19,	10,	19,	19,	10,	19,	19,	19,	19,	19,	19,	19,	10,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	10,	10,
+		19,	19,	10,	19,	10,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+	},
+	{ // block 66
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+	},
+	{ // block 67
+		19,	19,	19,	19,	19,	19,	19,	19,	10,	10,	10,	10,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		10,	10,	19,	19,	19,	19,	19,	19,	19,	46,	47,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	10,	19,	19,	19,
+	},
+	{ // block 68
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	10,	10,	10,	10,
+		10,	10,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 69
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+	},
+	{ // block 70
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,
+		48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,
+		48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	48,
+		48,	48,	48,	48,	48,	48,	48,	48,	48,	48,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+	},
+	{ // block 71
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 72
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	10,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	10,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	10,	10,	10,	10,	10,	10,	10,	10,
+	},
+	{ // block 73
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	10,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 74
+		28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	8,	9,	8,	9,	8,	9,	8,	9,
+		8,	9,	8,	9,	8,	9,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+	},
+	{ // block 75
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		10,	10,	10,	10,	10,	8,	9,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	8,	9,	8,	9,	8,	9,	8,	9,	8,	9,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+	},
+	{ // block 76
+		10,	10,	10,	8,	9,	8,	9,	8,	9,	8,	9,	8,	9,	8,	9,	8,
+		9,	8,	9,	8,	9,	8,	9,	8,	9,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	8,	9,	8,	9,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	8,	9,	10,	10,
+	},
+	{ // block 77
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,	10,
+		10,	10,	10,	10,	10,	19,	19,	10,	10,	10,	10,	10,	10,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 78
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 79
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	28,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	28,
+		15,	18,	15,	15,	15,	18,	18,	15,	18,	15,	18,	15,	18,	15,	15,	15,
+		15,	18,	15,	18,	18,	15,	18,	18,	18,	18,	18,	18,	26,	26,	15,	15,
+	},
+	{ // block 80
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	18,	19,	19,	19,	19,	19,	19,	15,	18,	15,	18,	27,
+		27,	27,	15,	18,	28,	28,	28,	28,	28,	5,	5,	5,	5,	23,	5,	5,
+	},
+	{ // block 81
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	28,	18,	28,	28,	28,	28,	28,	18,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	26,
+		5,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	27,
+	},
+	{ // block 82
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+	},
+	{ // block 83
+		5,	5,	21,	24,	21,	24,	5,	5,	5,	21,	24,	5,	21,	24,	5,	5,
+		5,	5,	5,	5,	5,	5,	5,	12,	5,	5,	12,	5,	21,	24,	5,	5,
+		21,	24,	8,	9,	8,	9,	8,	9,	8,	9,	5,	5,	5,	5,	5,	26,
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	12,	12,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 84
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	28,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 85
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+	},
+	{ // block 86
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	28,	28,	28,	28,
+	},
+	{ // block 87
+		50,	51,	51,	51,	49,	52,	53,	54,	46,	47,	46,	47,	46,	47,	46,	47,
+		46,	47,	49,	49,	46,	47,	46,	47,	46,	47,	46,	47,	55,	46,	47,	47,
+		49,	54,	54,	54,	54,	54,	54,	54,	54,	54,	56,	56,	56,	56,	57,	57,
+		55,	58,	58,	58,	58,	58,	49,	49,	54,	54,	54,	52,	36,	51,	49,	19,
+		28,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+	},
+	{ // block 88
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	28,	28,	56,	56,	59,	59,	60,	60,	53,
+		61,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	51,	58,	58,	58,	62,
+	},
+	{ // block 89
+		28,	28,	28,	28,	28,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	28,	28,
+		28,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+	},
+	{ // block 90
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	28,
+		49,	49,	63,	63,	63,	63,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	28,	28,	28,	28,	28,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,	62,
+	},
+	{ // block 91
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	28,
+		63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	23,	23,	23,	23,	23,	23,	23,	23,
+		49,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+	},
+	{ // block 92
+		63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,	63,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	28,
+	},
+	{ // block 93
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,	64,
+		64,	64,	64,	64,	64,	64,	64,	64,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+	},
+	{ // block 94
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+	},
+	{ // block 95
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 96
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+	},
+	{ // block 97
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	52,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+	},
+	{ // block 98
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+	},
+	{ // block 99
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	28,	28,	28,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	26,	26,	26,	26,	26,	26,	5,	5,
+	},
+	{ // block 100
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	26,	5,	5,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	20,	27,
+		29,	29,	29,	5,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	5,	26,
+	},
+	{ // block 101
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	28,	28,	28,	28,	28,	28,	28,	27,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		27,	27,	5,	5,	5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 102
+		16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,
+		16,	16,	16,	16,	16,	16,	16,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		16,	16,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		18,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	18,
+		26,	18,	18,	18,	18,	18,	18,	18,	18,	15,	18,	15,	18,	15,	15,	18,
+	},
+	{ // block 103
+		15,	18,	15,	18,	15,	18,	15,	18,	26,	16,	16,	15,	18,	15,	18,	28,
+		15,	18,	15,	18,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		15,	18,	15,	18,	15,	18,	15,	18,	15,	18,	15,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	26,	26,	18,	20,	20,	20,	20,	20,
+	},
+	{ // block 104
+		20,	20,	27,	20,	20,	20,	27,	20,	20,	20,	20,	27,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	33,	33,	27,	27,	33,	19,	19,	19,	19,	28,	28,	28,	28,
+		23,	23,	23,	23,	23,	23,	19,	19,	6,	19,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 105
+		33,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,
+		33,	33,	33,	33,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,	5,	5,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	20,	20,	20,	20,	20,	20,	5,	5,	5,	20,	28,	28,	28,	28,
+	},
+	{ // block 106
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	27,	27,	27,	5,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	33,	33,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	5,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	28,	28,	28,
+	},
+	{ // block 107
+		27,	27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	27,	33,	33,	27,	27,	27,	27,	33,	33,	27,	33,	33,	33,
+		33,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	5,	28,	26,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	5,	5,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 108
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	27,	33,
+		33,	27,	27,	33,	33,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	27,	20,	20,	20,	20,	20,	20,	20,	20,	27,	33,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	5,	5,	5,	5,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		35,	34,	34,	34,	34,	34,	34,	19,	19,	19,	34,	33,	28,	28,	28,	28,
+	},
+	{ // block 109
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,	34,
+		27,	34,	27,	27,	27,	34,	34,	27,	27,	34,	34,	34,	34,	34,	27,	27,
+		34,	27,	34,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	34,	34,	35,	5,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	33,	27,	27,	33,	33,
+		5,	5,	20,	26,	26,	33,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 110
+		28,	20,	20,	20,	20,	20,	20,	28,	28,	20,	20,	20,	20,	20,	20,	28,
+		28,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 111
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	33,	33,	27,	33,	33,	27,	33,	33,	5,	33,	27,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 112
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,	36,
+		36,	36,	36,	36,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,
+	},
+	{ // block 113
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+		66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,	66,
+	},
+	{ // block 114
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+	},
+	{ // block 115
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	65,	65,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+	},
+	{ // block 116
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+	},
+	{ // block 117
+		18,	18,	18,	18,	18,	18,	18,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	18,	18,	18,	18,	18,	28,	28,	28,	28,	28,	20,	27,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	10,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	28,	20,	28,
+		20,	20,	28,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 118
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,	16,
+		16,	16,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 119
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	8,	9,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 120
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		28,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	6,	19,	28,	28,
+	},
+	{ // block 121
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		68,	51,	51,	69,	68,	51,	51,	46,	47,	51,	28,	28,	28,	28,	28,	28,
+		27,	27,	27,	27,	27,	27,	27,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		51,	55,	55,	70,	70,	46,	47,	46,	47,	46,	47,	46,	47,	46,	47,	46,
+		47,	46,	47,	46,	47,	51,	51,	46,	47,	51,	51,	51,	51,	70,	70,	70,
+		68,	51,	71,	28,	68,	69,	51,	51,	55,	46,	47,	46,	47,	46,	47,	51,
+		51,	51,	72,	55,	72,	72,	72,	28,	51,	73,	51,	51,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 122
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	31,
+	},
+	{ // block 123
+		28,	51,	51,	51,	73,	51,	51,	71,	46,	47,	51,	72,	68,	55,	71,	51,
+		74,	74,	74,	74,	74,	74,	74,	74,	74,	74,	69,	68,	72,	72,	72,	51,
+		51,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,
+		75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	75,	46,	51,	47,	76,	70,
+		76,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,
+		77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	77,	46,	72,	47,	72,	46,
+		47,	5,	8,	9,	5,	5,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,
+		79,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,
+	},
+	{ // block 124
+		78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,
+		78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	78,	80,	80,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,
+		28,	28,	20,	20,	20,	20,	20,	20,	28,	28,	20,	20,	20,	20,	20,	20,
+		28,	28,	20,	20,	20,	20,	20,	20,	28,	28,	20,	20,	20,	28,	28,	28,
+		73,	73,	72,	76,	49,	73,	73,	28,	19,	10,	10,	10,	10,	19,	19,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	31,	31,	31,	19,	19,	28,	28,
+	},
+	{ // block 125
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	28,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 126
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,
+	},
+	{ // block 127
+		5,	5,	5,	28,	28,	28,	28,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	28,	28,	28,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	23,	23,	23,	23,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 128
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	23,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	27,	28,	28,
+	},
+	{ // block 129
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 130
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,
+		23,	23,	23,	23,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	38,	20,	20,	20,	20,	20,	20,	20,	20,	38,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 131
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	28,	28,	28,	28,	20,	20,	20,	20,	20,	20,	20,	20,
+		5,	38,	38,	38,	38,	38,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 132
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+	},
+	{ // block 133
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 134
+		20,	20,	20,	20,	20,	20,	28,	28,	20,	28,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	28,	20,	20,	28,	28,	28,	20,	28,	28,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	28,	5,	23,	23,	23,	23,	23,	23,	23,	23,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 135
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	23,	23,	23,	23,	23,	23,	28,	28,	28,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	5,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 136
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	20,	20,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 137
+		20,	27,	27,	27,	28,	27,	27,	28,	28,	28,	28,	28,	27,	27,	27,	27,
+		20,	20,	20,	20,	28,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	28,	28,	28,	28,	27,	27,	27,	28,	28,	28,	28,	27,
+		23,	23,	23,	23,	23,	23,	23,	23,	28,	28,	28,	28,	28,	28,	28,	28,
+		5,	5,	5,	5,	5,	5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	23,	23,	5,
+	},
+	{ // block 138
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	28,	28,	28,	5,	5,	5,	5,	5,	5,	5,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	28,	28,	23,	23,	23,	23,	23,	23,	23,	23,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	28,	28,	28,	28,	28,	23,	23,	23,	23,	23,	23,	23,	23,
+	},
+	{ // block 139
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 140
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	28,
+	},
+	{ // block 141
+		33,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	5,	5,	5,	5,	5,	5,	5,	28,	28,
+		28,	28,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	23,	23,	23,	23,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 142
+		27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		33,	33,	33,	27,	27,	27,	27,	33,	33,	27,	27,	5,	5,	31,	5,	5,
+		5,	5,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 143
+		27,	27,	27,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	27,	27,	27,	27,	27,	33,	27,	27,	27,
+		27,	27,	27,	27,	27,	28,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 144
+		27,	27,	33,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	33,	33,	33,	27,	27,	27,	27,	27,	27,	27,	27,	27,	33,
+		33,	20,	20,	20,	20,	5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 145
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	27,	33,	27,	33,	33,
+		27,	27,	27,	27,	27,	27,	33,	27,	28,	28,	28,	28,	28,	28,	28,	28,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 146
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 147
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,	38,
+		38,	38,	38,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		5,	5,	5,	5,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 148
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 149
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 150
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		20,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,
+		33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,
+		33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	33,	28,
+	},
+	{ // block 151
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	27,
+		27,	27,	27,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,	26,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 152
+		62,	53,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 153
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 154
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	28,	28,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	33,	33,	27,	27,	27,	19,	19,	19,	33,	33,	33,
+		33,	33,	33,	31,	31,	31,	31,	31,	31,	31,	31,	27,	27,	27,	27,	27,
+	},
+	{ // block 155
+		27,	27,	27,	19,	19,	27,	27,	27,	27,	27,	27,	27,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	27,	27,	27,	27,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 156
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	27,	27,	27,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 157
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,
+		23,	23,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 158
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,
+		18,	18,	18,	18,	18,	28,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+	},
+	{ // block 159
+		15,	15,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	15,	28,	15,	15,
+		28,	28,	15,	28,	28,	15,	15,	28,	28,	15,	15,	15,	15,	28,	15,	15,
+		15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	28,	18,	28,	18,	18,	18,
+		18,	18,	18,	18,	28,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 160
+		18,	18,	18,	18,	15,	15,	28,	15,	15,	15,	15,	28,	28,	15,	15,	15,
+		15,	15,	15,	15,	15,	28,	15,	15,	15,	15,	15,	15,	15,	28,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	28,	15,	15,	15,	15,	28,
+		15,	15,	15,	15,	15,	28,	15,	28,	28,	28,	15,	15,	15,	15,	15,	15,
+		15,	28,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+	},
+	{ // block 161
+		15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 162
+		18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+	},
+	{ // block 163
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	28,	28,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	10,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	10,	18,	18,	18,	18,
+		18,	18,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	10,	18,	18,	18,	18,
+	},
+	{ // block 164
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	10,	18,	18,	18,	18,	18,	18,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	10,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	10,
+		18,	18,	18,	18,	18,	18,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	10,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+	},
+	{ // block 165
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	10,	18,	18,	18,	18,	18,	18,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,	15,
+		15,	15,	15,	15,	15,	15,	15,	15,	15,	10,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,	18,
+		18,	18,	18,	10,	18,	18,	18,	18,	18,	18,	15,	18,	28,	28,	13,	13,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+		13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,	13,
+	},
+	{ // block 166
+		20,	20,	20,	20,	28,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,
+		28,	20,	20,	28,	20,	28,	28,	20,	28,	20,	20,	20,	20,	20,	20,	20,
+		20,	20,	20,	28,	20,	20,	20,	20,	28,	20,	28,	20,	28,	28,	28,	28,
+		28,	28,	20,	28,	28,	28,	28,	20,	28,	20,	28,	20,	28,	20,	20,	20,
+		28,	20,	20,	28,	20,	28,	28,	20,	28,	20,	28,	20,	28,	20,	28,	20,
+		28,	20,	20,	28,	20,	28,	28,	20,	20,	20,	20,	28,	20,	20,	20,	20,
+		20,	20,	20,	28,	20,	20,	20,	20,	28,	20,	20,	20,	20,	28,	20,	28,
+	},
+	{ // block 167
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,
+		28,	20,	20,	20,	28,	20,	20,	20,	20,	20,	28,	20,	20,	20,	20,	20,
+		20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	20,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		10,	10,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 168
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 169
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,
+		28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,
+		28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 170
+		23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	23,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 171
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,
+		81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,	81,
+	},
+	{ // block 172
+		49,	49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	49,	28,	28,	28,	28,	28,
+		49,	49,	49,	49,	49,	49,	49,	49,	49,	28,	28,	28,	28,	28,	28,	28,
+		49,	49,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 173
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	28,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,
+	},
+	{ // block 174
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	28,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 175
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,
+		19,	28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+	},
+	{ // block 176
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	28,	19,	19,	19,	19,	28,	28,	28,
+	},
+	{ // block 177
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	28,	28,
+		19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 178
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	19,	19,	19,	19,	19,
+	},
+	{ // block 179
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	28,	28,	28,	28,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 180
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 181
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,	19,
+		19,	19,	19,	19,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 182
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+	},
+	{ // block 183
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+	},
+	{ // block 184
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,
+		53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	53,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+	},
+	{ // block 185
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+	},
+	{ // block 186
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,
+		65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	65,	28,	28,
+	},
+	{ // block 187
+		28,	31,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+		31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,	31,
+	},
+	{ // block 188
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+	},
+	{ // block 189
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,	27,
+		28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,	28,
+	},
+	{ // block 190
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,
+		67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	67,	28,	28,
+	},
+};
+
+static const uint8_t property_index[] = {
+	  0,   1,   2,   3,   4,   5,   6,   7, // U+0000
+	  8,   9,  10,  11,  12,  13,  14,  15, // U+0400
+	 16,  17,  18,  19,  20,  21,  22,  23, // U+0800
+	 24,  25,  26,  27,  28,  29,  30,  31, // U+0C00
+	 32,  33,  34,  35,  36,  37,  38,  39, // U+1000
+	 40,  41,  41,  41,  42,  43,  44,  45, // U+1400
+	 46,  47,  48,  49,  50,  51,  52,  53, // U+1800
+	 54,  55,  56,  57,  58,  59,  60,  61, // U+1C00
+	 62,  63,  64,  65,  66,  66,  67,  68, // U+2000
+	 69,  70,  71,  72,  73,  71,  74,  75, // U+2400
+	 71,  71,  66,  76,  66,  66,  77,  78, // U+2800
+	 79,  80,  81,  82,  83,  84,  85,  86, // U+2C00
+	 87,  88,  89,  90,  91,  92,  93,  85, // U+3000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+3400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+3800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+3C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+4000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+4400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+4800
+	 94,  94,  94,  95,  94,  94,  94,  94, // U+4C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+5000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+5400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+5800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+5C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+6000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+6400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+6800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+6C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+7000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+7400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+7800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+7C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+8000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+8400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+8800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+8C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+9000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+9400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+9800
+	 94,  94,  94,  94,  94,  94,  94,  96, // U+9C00
+	 97,  98,  98,  98,  98,  98,  98,  98, // U+A000
+	 98,  99,  41,  41, 100, 101, 102, 103, // U+A400
+	104, 105, 106, 107, 108, 109, 110, 111, // U+A800
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+AC00
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+B000
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+B400
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+B800
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+BC00
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+C000
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+C400
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+C800
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+CC00
+	 98,  98,  98,  98,  98,  98,  98,  98, // U+D000
+	 98,  98,  98,  98,  98,  98,  98, 112, // U+D400
+	113, 113, 113, 113, 113, 113, 113, 113, // U+D800
+	113, 113, 113, 113, 113, 113, 113, 113, // U+DC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+E000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+E400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+E800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+EC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F400
+	114, 114,  94,  94, 115, 116, 117, 118, // U+F800
+	 41,  41, 119, 120, 121, 122, 123, 124, // U+FC00
+	125, 126, 127, 128,  78, 129, 130, 131, // U+10000
+	132, 133,  78,  78,  78,  78,  78,  78, // U+10400
+	134,  78, 135, 136, 137,  78, 138,  78, // U+10800
+	139,  78,  78,  78, 140,  78,  78,  78, // U+10C00
+	141, 142, 143, 144,  78,  78,  78,  78, // U+11000
+	 78,  78,  78,  78,  78, 145,  78,  78, // U+11400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+11800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+11C00
+	 41,  41,  41,  41,  41,  41, 146,  78, // U+12000
+	147,  78,  78,  78,  78,  78,  78,  78, // U+12400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+12800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+12C00
+	 41,  41,  41,  41,  41,  41,  41,  41, // U+13000
+	148,  78,  78,  78,  78,  78,  78,  78, // U+13400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+13800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+13C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+14000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+14400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+14800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+14C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+15000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+15400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+15800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+15C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+16000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+16400
+	 41,  41,  41,  41, 149,  78,  78,  78, // U+16800
+	 78,  78,  78,  78,  78,  78, 150, 151, // U+16C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+17000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+17400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+17800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+17C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+18000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+18400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+18800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+18C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+19000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+19400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+19800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+19C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1AC00
+	152,  78,  78,  78,  78,  78,  78,  78, // U+1B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1CC00
+	 71, 153, 154, 155, 156,  78, 157,  78, // U+1D000
+	158, 159, 160, 161, 162, 163, 164, 165, // U+1D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1E800
+	 78,  78,  78,  78, 166, 167,  78,  78, // U+1EC00
+	168, 169, 170, 171, 172,  78, 173, 174, // U+1F000
+	175, 176, 177, 178, 179, 180, 181,  78, // U+1F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+1FC00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+20000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+20400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+20800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+20C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+21000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+21400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+21800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+21C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+22000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+22400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+22800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+22C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+23000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+23400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+23800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+23C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+24000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+24400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+24800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+24C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+25000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+25400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+25800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+25C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+26000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+26400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+26800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+26C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+27000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+27400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+27800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+27C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+28000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+28400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+28800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+28C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+29000
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+29400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+29800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+29C00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+2A000
+	 94,  94,  94,  94,  94, 182,  94,  94, // U+2A400
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+2A800
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+2AC00
+	 94,  94,  94,  94,  94,  94,  94,  94, // U+2B000
+	 94,  94,  94,  94,  94,  94, 183,  94, // U+2B400
+	184, 185, 185, 185, 185, 185, 185, 185, // U+2B800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2BC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2C000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2C400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2C800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2CC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2D000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2D400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2D800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2DC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2E000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2E400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2E800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2EC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2F000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+2F400
+	 94,  94,  94,  94, 184, 185, 185, 185, // U+2F800
+	185, 185, 185, 185, 185, 185, 185, 186, // U+2FC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+30000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+30400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+30800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+30C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+31000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+31400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+31800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+31C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+32000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+32400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+32800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+32C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+33000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+33400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+33800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+33C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+34000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+34400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+34800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+34C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+35000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+35400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+35800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+35C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+36000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+36400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+36800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+36C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+37000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+37400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+37800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+37C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+38000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+38400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+38800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+38C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+39000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+39400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+39800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+39C00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3A000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3A400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3A800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3AC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3B000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3B400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3B800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3BC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3C000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3C400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3C800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3CC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3D000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3D400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3D800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3DC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3E000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3E400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3E800
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3EC00
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3F000
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3F400
+	185, 185, 185, 185, 185, 185, 185, 185, // U+3F800
+	185, 185, 185, 185, 185, 185, 185, 186, // U+3FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+40000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+40400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+40800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+40C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+41000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+41400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+41800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+41C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+42000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+42400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+42800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+42C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+43000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+43400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+43800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+43C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+44000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+44400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+44800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+44C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+45000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+45400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+45800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+45C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+46000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+46400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+46800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+46C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+47000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+47400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+47800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+47C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+48000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+48400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+48800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+48C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+49000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+49400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+49800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+49C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+4FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+50000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+50400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+50800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+50C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+51000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+51400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+51800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+51C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+52000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+52400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+52800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+52C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+53000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+53400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+53800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+53C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+54000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+54400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+54800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+54C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+55000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+55400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+55800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+55C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+56000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+56400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+56800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+56C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+57000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+57400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+57800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+57C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+58000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+58400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+58800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+58C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+59000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+59400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+59800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+59C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+5FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+60000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+60400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+60800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+60C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+61000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+61400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+61800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+61C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+62000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+62400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+62800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+62C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+63000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+63400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+63800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+63C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+64000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+64400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+64800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+64C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+65000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+65400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+65800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+65C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+66000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+66400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+66800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+66C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+67000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+67400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+67800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+67C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+68000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+68400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+68800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+68C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+69000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+69400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+69800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+69C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+6FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+70000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+70400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+70800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+70C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+71000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+71400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+71800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+71C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+72000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+72400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+72800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+72C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+73000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+73400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+73800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+73C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+74000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+74400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+74800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+74C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+75000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+75400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+75800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+75C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+76000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+76400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+76800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+76C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+77000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+77400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+77800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+77C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+78000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+78400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+78800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+78C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+79000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+79400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+79800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+79C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+7FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+80000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+80400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+80800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+80C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+81000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+81400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+81800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+81C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+82000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+82400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+82800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+82C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+83000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+83400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+83800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+83C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+84000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+84400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+84800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+84C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+85000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+85400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+85800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+85C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+86000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+86400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+86800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+86C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+87000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+87400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+87800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+87C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+88000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+88400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+88800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+88C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+89000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+89400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+89800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+89C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+8FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+90000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+90400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+90800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+90C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+91000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+91400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+91800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+91C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+92000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+92400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+92800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+92C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+93000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+93400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+93800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+93C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+94000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+94400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+94800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+94C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+95000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+95400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+95800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+95C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+96000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+96400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+96800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+96C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+97000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+97400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+97800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+97C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+98000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+98400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+98800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+98C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+99000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+99400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+99800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+99C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9A000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9A400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9A800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9AC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9B000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9B400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9B800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9BC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9C000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9C400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9C800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9CC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9D000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9D400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9D800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9DC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9E000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9E400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9E800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9EC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9F000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9F400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9F800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+9FC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A0000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A0400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A0800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A0C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A1000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A1400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A1800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A1C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A2000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A2400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A2800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A2C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A3000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A3400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A3800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A3C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A4000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A4400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A4800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A4C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A5000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A5400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A5800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A5C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A6000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A6400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A6800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A6C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A7000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A7400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A7800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A7C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A8000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A8400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A8800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A8C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A9000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A9400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A9800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+A9C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AA000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AA400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AA800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AAC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AB000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AB400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AB800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ABC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AC000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AC400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AC800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ACC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AD000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AD400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AD800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ADC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AE000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AE400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AE800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AEC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AF000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AF400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AF800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+AFC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B0000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B0400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B0800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B0C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B1000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B1400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B1800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B1C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B2000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B2400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B2800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B2C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B3000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B3400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B3800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B3C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B4000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B4400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B4800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B4C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B5000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B5400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B5800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B5C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B6000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B6400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B6800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B6C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B7000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B7400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B7800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B7C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B8000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B8400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B8800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B8C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B9000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B9400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B9800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+B9C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BA000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BA400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BA800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BAC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BB000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BB400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BB800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BBC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BC000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BC400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BC800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BCC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BD000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BD400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BD800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BDC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BE000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BE400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BE800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BEC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BF000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BF400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BF800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+BFC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C0000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C0400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C0800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C0C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C1000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C1400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C1800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C1C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C2000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C2400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C2800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C2C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C3000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C3400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C3800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C3C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C4000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C4400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C4800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C4C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C5000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C5400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C5800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C5C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C6000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C6400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C6800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C6C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C7000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C7400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C7800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C7C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C8000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C8400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C8800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C8C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C9000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C9400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C9800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+C9C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CA000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CA400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CA800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CAC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CB000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CB400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CB800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CBC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CC000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CC400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CC800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CCC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CD000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CD400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CD800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CDC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CE000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CE400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CE800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CEC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CF000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CF400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CF800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+CFC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D0000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D0400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D0800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D0C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D1000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D1400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D1800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D1C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D2000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D2400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D2800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D2C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D3000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D3400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D3800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D3C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D4000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D4400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D4800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D4C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D5000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D5400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D5800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D5C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D6000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D6400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D6800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D6C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D7000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D7400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D7800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D7C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D8000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D8400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D8800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D8C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D9000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D9400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D9800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+D9C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DA000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DA400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DA800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DAC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DB000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DB400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DB800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DBC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DC000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DC400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DC800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DCC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DD000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DD400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DD800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DDC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DE000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DE400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DE800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DEC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DF000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DF400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DF800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+DFC00
+	187,  78, 188, 189,  78,  78,  78,  78, // U+E0000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E0400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E0800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E0C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E1000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E1400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E1800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E1C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E2000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E2400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E2800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E2C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E3000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E3400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E3800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E3C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E4000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E4400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E4800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E4C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E5000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E5400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E5800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E5C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E6000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E6400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E6800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E6C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E7000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E7400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E7800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E7C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E8000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E8400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E8800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E8C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E9000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E9400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E9800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+E9C00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EA000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EA400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EA800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EAC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EB000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EB400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EB800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EBC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EC000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EC400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EC800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ECC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ED000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ED400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+ED800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EDC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EE000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EE400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EE800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EEC00
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EF000
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EF400
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EF800
+	 78,  78,  78,  78,  78,  78,  78,  78, // U+EFC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F0000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F0400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F0800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F0C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F1000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F1400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F1800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F1C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F2000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F2400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F2800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F2C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F3000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F3400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F3800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F3C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F4000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F4400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F4800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F4C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F5000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F5400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F5800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F5C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F6000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F6400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F6800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F6C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F7000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F7400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F7800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F7C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F8000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F8400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F8800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F8C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F9000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F9400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F9800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+F9C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FA000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FA400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FA800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FAC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FB000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FB400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FB800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FBC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FC000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FC400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FC800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FCC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FD000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FD400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FD800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FDC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FE000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FE400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FE800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FEC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FF000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FF400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+FF800
+	114, 114, 114, 114, 114, 114, 114, 190, // U+FFC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+100000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+100400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+100800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+100C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+101000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+101400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+101800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+101C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+102000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+102400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+102800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+102C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+103000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+103400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+103800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+103C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+104000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+104400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+104800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+104C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+105000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+105400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+105800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+105C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+106000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+106400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+106800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+106C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+107000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+107400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+107800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+107C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+108000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+108400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+108800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+108C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+109000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+109400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+109800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+109C00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10A000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10A400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10A800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10AC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10B000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10B400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10B800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10BC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10C000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10C400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10C800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10CC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10D000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10D400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10D800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10DC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10E000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10E400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10E800
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10EC00
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10F000
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10F400
+	114, 114, 114, 114, 114, 114, 114, 114, // U+10F800
+	114, 114, 114, 114, 114, 114, 114, 190, // U+10FC00
+};
@@ -1,11566 +0,0 @@
-enum unicode_word_break {
-	UNICODE_WORD_BREAK_ALETTER,
-	UNICODE_WORD_BREAK_CR,
-	UNICODE_WORD_BREAK_EXTEND,
-	UNICODE_WORD_BREAK_EXTENDNUMLET,
-	UNICODE_WORD_BREAK_FORMAT,
-	UNICODE_WORD_BREAK_KATAKANA,
-	UNICODE_WORD_BREAK_LF,
-	UNICODE_WORD_BREAK_MIDLETTER,
-	UNICODE_WORD_BREAK_MIDNUM,
-	UNICODE_WORD_BREAK_MIDNUMLET,
-	UNICODE_WORD_BREAK_NEWLINE,
-	UNICODE_WORD_BREAK_NUMERIC,
-	UNICODE_WORD_BREAK_OTHER,
-	UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-};
-
-static const int8_t word_break_data[][256] = {
-	{ // page 0, index 0
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_LF, UNICODE_WORD_BREAK_NEWLINE,
-		UNICODE_WORD_BREAK_NEWLINE, UNICODE_WORD_BREAK_CR,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDNUMLET,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_MIDLETTER, UNICODE_WORD_BREAK_MIDNUM,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_NEWLINE,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDLETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 2, index 1
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 3, index 2
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_MIDLETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 4, index 3
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 5, index 4
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDNUM,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_MIDLETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 6, index 5
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_MIDNUM,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 7, index 6
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 8, index 7
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 9, index 8
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 10, index 9
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 11, index 10
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 12, index 11
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 13, index 12
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 14, index 13
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 15, index 14
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 16, index 15
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 18, index 16
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 19, index 17
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 20, index 18
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 22, index 19
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 23, index 20
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 24, index 21
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 25, index 22
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 26, index 23
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 27, index 24
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 28, index 25
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 29, index 26
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-	},
-	{ // page 31, index 27
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 32, index 28
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WORD_BREAK_MIDNUMLET,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDLETTER,
-		UNICODE_WORD_BREAK_NEWLINE, UNICODE_WORD_BREAK_NEWLINE,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 33, index 29
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 36, index 30
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 44, index 31
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 45, index 32
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-	},
-	{ // page 46, index 33
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 48, index 34
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-	},
-	{ // page 49, index 35
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-	},
-	{ // page 50, index 36
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 51, index 37
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 164, index 38
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 166, index 39
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 167, index 40
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 168, index 41
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 169, index 42
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 170, index 43
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 171, index 44
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 215, index 45
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 251, index 46
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 253, index 47
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 254, index 48
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDLETTER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_EXTENDNUMLET, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_MIDLETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-	},
-	{ // page 255, index 49
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_MIDNUMLET,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUM, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDNUMLET, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_MIDLETTER, UNICODE_WORD_BREAK_MIDNUM,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTENDNUMLET,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_KATAKANA,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 256, index 50
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 257, index 51
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 258, index 52
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 259, index 53
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 260, index 54
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 264, index 55
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 265, index 56
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 266, index 57
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 267, index 58
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 268, index 59
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 272, index 60
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 273, index 61
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 278, index 62
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 291, index 63
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 292, index 64
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 308, index 65
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 362, index 66
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 367, index 67
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 432, index 68
-		UNICODE_WORD_BREAK_KATAKANA, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 465, index 69
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 466, index 70
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 468, index 71
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 469, index 72
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 470, index 73
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-	},
-	{ // page 471, index 74
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-		UNICODE_WORD_BREAK_NUMERIC, UNICODE_WORD_BREAK_NUMERIC,
-	},
-	{ // page 494, index 75
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_ALETTER, UNICODE_WORD_BREAK_ALETTER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 497, index 76
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-		UNICODE_WORD_BREAK_REGIONAL_INDICATOR, UNICODE_WORD_BREAK_REGIONAL_INDICATOR,
-	},
-	{ // page 3584, index 77
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_FORMAT, UNICODE_WORD_BREAK_FORMAT,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-	{ // page 3585, index 78
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_EXTEND, UNICODE_WORD_BREAK_EXTEND,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-		UNICODE_WORD_BREAK_OTHER, UNICODE_WORD_BREAK_OTHER,
-	},
-};
-
-#define UNICODE_LAST_CHAR_WORD_BREAK_PART_1 ((uchar)0x1f1ff)
-#define UNICODE_WORD_BREAK_DATA_MAX_INDEX ((uint8_t)79)
-
-// U+0000 through U+1F1FF
-static const uint8_t word_break_pages_part_1[] = {
-	0, // page 0
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	1, // page 2
-	2, // page 3
-	3, // page 4
-	4, // page 5
-	5, // page 6
-	6, // page 7
-	7, // page 8
-	8, // page 9
-	9, // page 10
-	10, // page 11
-	11, // page 12
-	12, // page 13
-	13, // page 14
-	14, // page 15
-	15, // page 16
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	16, // page 18
-	17, // page 19
-	18, // page 20
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	19, // page 22
-	20, // page 23
-	21, // page 24
-	22, // page 25
-	23, // page 26
-	24, // page 27
-	25, // page 28
-	26, // page 29
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	27, // page 31
-	28, // page 32
-	29, // page 33
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	30, // page 36
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	31, // page 44
-	32, // page 45
-	33, // page 46
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	34, // page 48
-	35, // page 49
-	36, // page 50
-	37, // page 51
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	38, // page 164
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	39, // page 166
-	40, // page 167
-	41, // page 168
-	42, // page 169
-	43, // page 170
-	44, // page 171
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	45, // page 215
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	46, // page 251
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	47, // page 253
-	48, // page 254
-	49, // page 255
-	50, // page 256
-	51, // page 257
-	52, // page 258
-	53, // page 259
-	54, // page 260
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	55, // page 264
-	56, // page 265
-	57, // page 266
-	58, // page 267
-	59, // page 268
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	60, // page 272
-	61, // page 273
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	62, // page 278
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	63, // page 291
-	64, // page 292
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	65, // page 308
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_ALETTER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	66, // page 362
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	67, // page 367
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	68, // page 432
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	69, // page 465
-	70, // page 466
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	71, // page 468
-	72, // page 469
-	73, // page 470
-	74, // page 471
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	75, // page 494
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	76, // page 497
-};
-
-// U+E0000 through U+10FFFF
-static const uint8_t word_break_pages_part_2[] = {
-	77, // page 3584
-	78, // page 3585
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-	UNICODE_WORD_BREAK_OTHER + UNICODE_WORD_BREAK_DATA_MAX_INDEX,
-};
@@ -5,9 +5,17 @@
 #include <getopt.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
+#ifdef HAVE_MMAP
+#  include <sys/mman.h>
+#endif
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <nmc.h>
@@ -24,6 +32,14 @@ struct nmc_option {
         const char *argument;
         const char *help;
 } options[] = {
+        { 'f', "format", required_argument, "FORMAT",
+          "Output FORMAT, either xml (the default), html, or man" },
+        { 'p', "param", required_argument, "NAME=VALUE",
+          "Set output parameter NAME to VALUE" },
+        { 'o', "output-directory", required_argument, "DIR",
+          "Write output for each FILE to DIR" },
+        { 'j', "jobs", required_argument, "N",
+          "Convert up to N FILEs, or sections, in parallel" },
         { 'h', "help", no_argument, NULL, "Display this help" },
         { 'V', "version", no_argument, NULL, "Display version string" },
         { '\0', NULL, no_argument, NULL, NULL }
@@ -59,6 +75,38 @@ report_nmc_error(const struct nmc_error *error, const char *path)
                 fputc('\n', stderr) != EOF;
 }
 
+// NOTE Errors are collected in a report instead of being output directly,
+// so that they can be output in order when FILEs are converted in parallel.
+struct report {
+        const char *path;
+        struct nmc_parser_error *errors;
+        bool failed;
+        struct nmc_error error;
+};
+
+#define REPORT_INIT { NULL, NULL, false, { NULL, 0, NULL } }
+
+static bool
+report_failure(struct report *report, const char *path)
+{
+        report->path = path;
+        report->failed = true;
+        return false;
+}
+
+static void
+report_output(struct report *report)
+{
+        list_for_each(struct nmc_parser_error, p, report->errors)
+                if (!report_nmc_parser_error(p, report->path))
+                        break;
+        nmc_parser_error_free(report->errors);
+        if (report->failed) {
+                report_nmc_error(&report->error, report->path);
+                nmc_error_release(&report->error);
+        }
+}
+
 static size_t
 option_width(struct nmc_option *option)
 {
@@ -81,8 +129,11 @@ static void
 usage(void)
 {
         fprintf(stdout,
-                "Usage: %s [OPTION]... [FILE]\n"
-                "Process FILE or standard input as NoMarks text and turn it into NoMarks XML.\n"
+                "Usage: %s [OPTION]... [FILE]...\n"
+                "Process FILE or standard input as NoMarks text and turn it into NoMarks XML,\n"
+                "or HTML or a manual page with --format.\n"
+                "With --output-directory, process each FILE and write it to DIR, replacing\n"
+                "its extension with “.nml”, “.html”, or the manual section.\n"
                 "\n"
                 "Options:\n",
                 PACKAGE_NAME);
@@ -116,87 +167,412 @@ usage(void)
         }
 }
 
-static bool
-convert(char *content, const char *path)
+struct input {
+        char *content;
+        size_t length;
+        size_t mapped;
+};
+
+static void
+input_release(struct input *input)
 {
-        struct nmc_parser_error *errors = NULL;
-        struct nmc_node *doc = nmc_parse(content, &errors);
-        free(content);
-        if (doc == NULL) {
-                list_for_each(struct nmc_parser_error, p, errors)
-                        if (!report_nmc_parser_error(p, path))
-                                break;
-                nmc_parser_error_free(errors);
-                return false;
+#ifdef HAVE_MMAP
+        if (input->mapped > 0) {
+                munmap(input->content, input->mapped);
+                return;
         }
+#endif
+        free(input->content);
+}
 
-        struct nmc_fd_output fd;
-        nmc_fd_output_init(&fd, STDOUT_FILENO);
+static bool
+write_xml(const struct nmc_context *context, struct nmc_node *node,
+          UNUSED(const char *const *params), struct nmc_output *output,
+          struct nmc_error *error)
+{
+        return nmc_node_xml(context, node, output, error);
+}
+
+static bool
+write_html(const struct nmc_context *context, struct nmc_node *node,
+           UNUSED(const char *const *params), struct nmc_output *output,
+           struct nmc_error *error)
+{
+        return nmc_node_html(context, node, output, error);
+}
+
+// NOTE The extension of man output is the section, so NULL here.  Formats
+// that can be written on several threads at once also have write_parallel.
+struct format {
+        const char *name;
+        const char *extension;
+        bool (*write)(const struct nmc_context *, struct nmc_node *,
+                      const char *const *, struct nmc_output *,
+                      struct nmc_error *);
+        bool (*write_parallel)(const struct nmc_context *, struct nmc_node *,
+                               size_t, struct nmc_output *,
+                               struct nmc_error *);
+        const char *const *params;
+} formats[] = {
+        { "xml", ".nml", write_xml, nmc_node_xml_parallel, NULL },
+        { "html", ".html", write_html, NULL, NULL },
+        { "man", NULL, nmc_node_man, NULL, NULL },
+};
+
+#define OUTPUT_BUFFER_SIZE 65536
+
+static bool
+write_fd(const struct nmc_context *context, const struct format *format,
+         struct nmc_document *doc, int fd, size_t threads,
+         struct nmc_error *error)
+{
+        struct nmc_fd_output fd_output;
+        nmc_fd_output_init(&fd_output, fd);
+        char buffer[OUTPUT_BUFFER_SIZE];
         struct nmc_buffered_output output;
-        nmc_buffered_output_init(&output, &fd.output);
-        struct nmc_error error;
-        bool r = nmc_node_xml(doc, &output.output, &error);
+        nmc_buffered_output_init(&output, &fd_output.output, buffer, sizeof(buffer));
+        if (threads > 1 && format->write_parallel != NULL ?
+            format->write_parallel(context, doc->root, threads,
+                                   &output.output, error) :
+            format->write(context, doc->root, format->params, &output.output,
+                          error))
+                return nmc_output_close(&output.output, error);
         struct nmc_error ignored;
-        nmc_output_close(&output.output, r ? &error : &ignored);
-        nmc_node_free(doc);
+        nmc_output_close(&output.output, &ignored);
+        return false;
+}
+
+static bool
+write_path(const struct nmc_context *context, const struct format *format,
+           struct nmc_document *doc, const char *path, size_t threads,
+           struct nmc_error *error)
+{
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        if (fd == -1)
+                return nmc_error_init(error, errno, "error opening file");
+        if (!write_fd(context, format, doc, fd, threads, error)) {
+                close(fd);
+                return false;
+        }
+        if (close(fd) == -1)
+                return nmc_error_init(error, errno, "error closing file");
+        return true;
+}
+
+static bool
+write_document(const struct nmc_context *context, const struct format *format,
+               struct nmc_document *doc, const char *path, const char *output,
+               size_t threads, struct report *report)
+{
+        bool r = output == NULL ?
+                write_fd(context, format, doc, STDOUT_FILENO, threads,
+                         &report->error) :
+                write_path(context, format, doc, output, threads,
+                           &report->error);
+        nmc_document_free(doc);
         if (!r)
-                report_nmc_error(&error, path);
+                return report_failure(report, output == NULL ? path : output);
+        return true;
+}
+
+static bool
+convert(const struct nmc_context *context, const struct format *format,
+        struct input *input, const char *path, const char *output,
+        size_t threads, struct report *report)
+{
+        struct nmc_document *doc = nmc_parse_parallel(context,
+                                                      input->content,
+                                                      input->length,
+                                                      NMC_PARSE_REFERENCE_INPUT,
+                                                      threads, &report->errors);
+        if (doc == NULL) {
+                input_release(input);
+                report->path = path;
+                return false;
+        }
+
+        bool r = write_document(context, format, doc, path, output, threads,
+                                report);
+        input_release(input);
         return r;
 }
 
 static bool
-read_fd(int fd, char **content, struct nmc_error *error)
+read_fd(int fd, struct input *input, struct nmc_error *error)
 {
         struct buffer b = BUFFER_INIT;
         if (!buffer_read(&b, fd, 0)) {
                 free(b.content);
                 return nmc_error_init(error, errno, "error reading from file");
         }
-        *content = buffer_str(&b);
+        input->content = buffer_str(&b);
+        input->length = b.length;
+        input->mapped = 0;
         return true;
 }
 
+#ifdef HAVE_MMAP
 static bool
-convert_stdin(void)
+map_fd(int fd, struct input *input)
 {
-        char *content;
-        struct nmc_error error;
-        if (!read_fd(STDIN_FILENO, &content, &error)) {
-                report_nmc_error(&error, NULL);
+        struct stat s;
+        if (fstat(fd, &s) == -1 || !S_ISREG(s.st_mode) || s.st_size <= 0 ||
+            (uintmax_t)s.st_size > SIZE_MAX)
+                return false;
+        size_t length = (size_t)s.st_size;
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE;
+#endif
+        char *p = mmap(NULL, length, PROT_READ, flags, fd, 0);
+        if (p == MAP_FAILED)
                 return false;
+#if defined(HAVE_MADVISE) && defined(MADV_SEQUENTIAL)
+        madvise(p, length, MADV_SEQUENTIAL);
+#endif
+        input->content = p;
+        input->length = length;
+        input->mapped = length;
+        return true;
+}
+#endif
+
+#define STDIN_BUFFER_SIZE 65536
+
+// NOTE Standard input is often a pipe from something slower than the
+// parser, so it’s fed to a push parser as it arrives instead of being
+// read whole first.  Once parsing has failed, the rest isn’t read.
+static bool
+parse_stdin(const struct nmc_context *context, struct nmc_document **doc,
+            struct report *report)
+{
+        struct nmc_parser *parser = nmc_parser_new(context, 0);
+        if (parser == NULL)
+                return nmc_error_oom(&report->error);
+        char b[STDIN_BUFFER_SIZE];
+        ssize_t n;
+        do
+                n = read(STDIN_FILENO, b, sizeof(b));
+        while ((n > 0 && nmc_parser_feed(parser, b, (size_t)n)) ||
+               (n == -1 && errno == EINTR));
+        int e = errno;
+        *doc = nmc_parser_finish(parser, &report->errors);
+        if (n == -1) {
+                nmc_document_free(*doc);
+                nmc_parser_error_free(report->errors);
+                report->errors = NULL;
+                return nmc_error_init(&report->error, e,
+                                      "error reading from file");
         }
-        return convert(content, NULL);
+        return true;
 }
 
 static bool
-read_path(const char *path, char **content, struct nmc_error *error)
+convert_stdin(const struct nmc_context *context, const struct format *format)
+{
+        struct report report = REPORT_INIT;
+        struct nmc_document *doc;
+        bool r;
+        if (!parse_stdin(context, &doc, &report))
+                r = report_failure(&report, NULL);
+        else
+                r = doc != NULL &&
+                        write_document(context, format, doc, NULL, NULL, 1,
+                                       &report);
+        report_output(&report);
+        return r;
+}
+
+static bool
+read_path(const char *path, struct input *input, struct nmc_error *error)
 {
         int fd = open(path, O_RDONLY);
         if (fd == -1)
                 return nmc_error_init(error, errno, "error opening file");
-        if (!read_fd(fd, content, error)) {
+#ifdef HAVE_MMAP
+        // NOTE Anything that can’t be mapped, like pipes and empty files, is
+        // read instead.
+        if (!map_fd(fd, input) && !read_fd(fd, input, error)) {
+#else
+        if (!read_fd(fd, input, error)) {
+#endif
                 close(fd);
                 return false;
         }
         if (close(fd) == -1) {
-                free(*content);
+                input_release(input);
                 return nmc_error_init(error, errno, "error closing file");
         }
         return true;
 }
 
 static bool
-convert_path(const char *path)
+output_path(struct buffer *output, const struct format *format,
+            const char *directory, const char *path)
 {
-        char *content;
-        struct nmc_error error;
-        if (!read_path(path, &content, &error)) {
-                report_nmc_error(&error, path);
-                return false;
+        const char *base = strrchr(path, '/');
+        base = base == NULL ? path : base + 1;
+        const char *extension = strrchr(base, '.');
+        if (extension == NULL || extension == base)
+                extension = base + strlen(base);
+        output->length = 0;
+        return buffer_append(output, directory, strlen(directory)) &&
+                buffer_append_c(output, '/', 1) &&
+                buffer_append(output, base, extension - base) &&
+                buffer_append(output, format->extension,
+                              strlen(format->extension)) &&
+                buffer_cstr(output) != NULL;
+}
+
+static bool
+convert_path(const struct nmc_context *context, const struct format *format,
+             const char *path, const char *directory, struct buffer *output,
+             size_t threads, struct report *report)
+{
+        if (directory != NULL && !output_path(output, format, directory, path)) {
+                nmc_error_oom(&report->error);
+                return report_failure(report, path);
         }
-        return convert(content, path);
+        struct input input = { NULL, 0, 0 };
+        if (!read_path(path, &input, &report->error))
+                return report_failure(report, path);
+        return convert(context, format, &input, path,
+                       directory != NULL ? output->content : NULL, threads,
+                       report);
 }
 
+static bool
+convert_paths(const struct nmc_context *context, const struct format *format,
+              char *const *paths, size_t n, const char *directory,
+              size_t threads)
+{
+        // NOTE The output path buffer, like the context, is shared by all
+        // FILEs.
+        struct buffer output = BUFFER_INIT;
+        bool r = true;
+        for (size_t i = 0; i < n; i++) {
+                struct report report = REPORT_INIT;
+                if (!convert_path(context, format, paths[i], directory, &output,
+                                  threads, &report))
+                        r = false;
+                report_output(&report);
+        }
+        free(output.content);
+        return r;
+}
+
+#ifdef HAVE_PTHREAD
+struct job {
+        const char *path;
+        off_t size;
+        bool done;
+        bool converted;
+        struct report report;
+};
+
+struct pool {
+        const struct nmc_context *context;
+        const struct format *format;
+        struct job **queue;
+        size_t n;
+        size_t next;
+        const char *directory;
+        pthread_mutex_t mutex;
+        pthread_cond_t done;
+};
+
+static void *
+worker(void *closure)
+{
+        struct pool *pool = closure;
+        struct buffer output = BUFFER_INIT;
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->next < pool->n) {
+                struct job *job = pool->queue[pool->next++];
+                pthread_mutex_unlock(&pool->mutex);
+                job->converted = convert_path(pool->context, pool->format,
+                                              job->path, pool->directory,
+                                              &output, 1, &job->report);
+                pthread_mutex_lock(&pool->mutex);
+                job->done = true;
+                pthread_cond_broadcast(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->mutex);
+        free(output.content);
+        return NULL;
+}
+
+static int
+job_size_cmp(const void *a, const void *b)
+{
+        off_t x = (*(struct job *const *)a)->size;
+        off_t y = (*(struct job *const *)b)->size;
+        return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static bool
+convert_paths_parallel(const struct nmc_context *context,
+                       const struct format *format, char *const *paths,
+                       size_t n, const char *directory, size_t threads)
+{
+        struct job *jobs = malloc(sizeof(struct job) * n);
+        struct pool pool;
+        pool.context = context;
+        pool.format = format;
+        pool.queue = malloc(sizeof(struct job *) * n);
+        pool.n = n;
+        pool.next = 0;
+        pool.directory = directory;
+        pthread_t *workers = malloc(sizeof(pthread_t) * threads);
+        if (jobs == NULL || pool.queue == NULL || workers == NULL) {
+                free(workers);
+                free(pool.queue);
+                free(jobs);
+                return convert_paths(context, format, paths, n, directory, 1);
+        }
+        for (size_t i = 0; i < n; i++) {
+                struct stat s;
+                jobs[i] = (struct job){
+                        paths[i], stat(paths[i], &s) == 0 ? s.st_size : 0,
+                        false, false, REPORT_INIT
+                };
+                pool.queue[i] = &jobs[i];
+        }
+        // NOTE Workers take the largest remaining FILE, so that a large
+        // FILE isn’t left for last, keeping one worker busy while the others
+        // idle.
+        qsort(pool.queue, n, sizeof(*pool.queue), job_size_cmp);
+        pthread_mutex_init(&pool.mutex, NULL);
+        pthread_cond_init(&pool.done, NULL);
+        size_t started = 0;
+        while (started < threads &&
+               pthread_create(&workers[started], NULL, worker, &pool) == 0)
+                started++;
+        if (started == 0)
+                worker(&pool);
+
+        bool r = true;
+        for (size_t i = 0; i < n; i++) {
+                pthread_mutex_lock(&pool.mutex);
+                while (!jobs[i].done)
+                        pthread_cond_wait(&pool.done, &pool.mutex);
+                pthread_mutex_unlock(&pool.mutex);
+                report_output(&jobs[i].report);
+                if (!jobs[i].converted)
+                        r = false;
+        }
+
+        for (size_t i = 0; i < started; i++)
+                pthread_join(workers[i], NULL);
+        pthread_cond_destroy(&pool.done);
+        pthread_mutex_destroy(&pool.mutex);
+        free(workers);
+        free(pool.queue);
+        free(jobs);
+        return r;
+}
+#endif
+
 static PURE size_t
 short_length(void)
 {
@@ -242,51 +618,130 @@ main(int argc, char *const *argv)
         args_fill(shorts, longs);
         opterr = 0;
         int index;
-        switch (getopt_long(argc, argv, shorts, longs, &index)) {
-        case 'h':
-                usage();
-                return EXIT_SUCCESS;
-        case 'V':
-                fprintf(stdout, "%s\n", PACKAGE_STRING);
-                return EXIT_SUCCESS;
-        case '?':
-                if (optopt == 0) {
-                        fprintf(stderr, "%s: unknown option: %s\n",
-                                PACKAGE_NAME, argv[optind - 1]);
-                        return EXIT_FAILURE;
+        struct format format = formats[0];
+        const char *params[2 * argc + 1];
+        size_t n_params = 0;
+        const char *directory = NULL;
+        size_t jobs = 1;
+        int c;
+        while ((c = getopt_long(argc, argv, shorts, longs, &index)) != -1) {
+                switch (c) {
+                case 'f': {
+                        size_t i = 0;
+                        while (i < lengthof(formats) &&
+                               strcmp(optarg, formats[i].name) != 0)
+                                i++;
+                        if (i == lengthof(formats)) {
+                                fprintf(stderr, "%s: invalid format: %s\n",
+                                        PACKAGE_NAME, optarg);
+                                return EXIT_FAILURE;
+                        }
+                        format = formats[i];
+                        break;
                 }
-                options_for_each(p) {
-                        if (p->c == optopt) {
-                                fprintf(stderr,
-                                        "%s: option --%s requires an argument\n",
-                                        PACKAGE_NAME, p->name);
+                case 'p': {
+                        char *value = strchr(optarg, '=');
+                        if (value == NULL || value == optarg) {
+                                fprintf(stderr, "%s: invalid parameter: %s\n",
+                                        PACKAGE_NAME, optarg);
                                 return EXIT_FAILURE;
                         }
+                        *value++ = '\0';
+                        params[n_params++] = optarg;
+                        params[n_params++] = value;
+                        break;
+                }
+                case 'o':
+                        directory = optarg;
+                        break;
+                case 'j': {
+                        char *end;
+                        errno = 0;
+                        unsigned long n = strtoul(optarg, &end, 10);
+                        if (*optarg == '\0' || *end != '\0' || errno != 0 ||
+                            n == 0) {
+                                fprintf(stderr, "%s: invalid number of jobs: %s\n",
+                                        PACKAGE_NAME, optarg);
+                                return EXIT_FAILURE;
+                        }
+                        jobs = n;
+                        break;
+                }
+                case 'h':
+                        usage();
+                        return EXIT_SUCCESS;
+                case 'V':
+                        fprintf(stdout, "%s\n", PACKAGE_STRING);
+                        return EXIT_SUCCESS;
+                case '?':
+                        if (optopt == 0) {
+                                fprintf(stderr, "%s: unknown option: %s\n",
+                                        PACKAGE_NAME, argv[optind - 1]);
+                                return EXIT_FAILURE;
+                        }
+                        options_for_each(p) {
+                                if (p->c == optopt) {
+                                        fprintf(stderr,
+                                                "%s: option --%s requires an argument\n",
+                                                PACKAGE_NAME, p->name);
+                                        return EXIT_FAILURE;
+                                }
+                        }
+                        fprintf(stderr, "%s: unknown option: -%c\n", PACKAGE_NAME, optopt);
+                        return EXIT_FAILURE;
                 }
-                fprintf(stderr, "%s: unknown option: -%c\n", PACKAGE_NAME, optopt);
-                return EXIT_FAILURE;
-        case -1:
-                break;
         }
-        const char *path = NULL;
-        if (optind < argc)
-                path = argv[optind++];
-        if (optind != argc) {
-                fprintf(stderr, "%s: unknown argument: %s\n",
-                        PACKAGE_NAME, argv[optind]);
+        if (directory == NULL && argc - optind > 1) {
+                fprintf(stderr, "%s: more than one FILE requires --output-directory\n",
+                        PACKAGE_NAME);
+                return EXIT_FAILURE;
+        } else if (directory != NULL && optind == argc) {
+                fprintf(stderr, "%s: option --output-directory requires a FILE\n",
+                        PACKAGE_NAME);
                 return EXIT_FAILURE;
         }
+        params[n_params] = NULL;
+        format.params = params;
+        const char *section = "1";
+        for (size_t i = 0; i < n_params; i += 2)
+                if (strcmp(params[i], "section") == 0) {
+                        section = params[i + 1];
+                        break;
+                }
+        char extension[strlen(section) + 2];
+        if (format.extension == NULL) {
+                extension[0] = '.';
+                strcpy(extension + 1, section);
+                format.extension = extension;
+        }
+
+        if (getenv("NMC_DEBUG") != NULL)
+                nmc_grammar_debug = 1;
 
+        struct nmc_context context;
         struct nmc_error error;
-        if (!nmc_initialize(&error))
+        if (!nmc_context_init(&context, 0, &error)) {
+                report_nmc_error(&error, NULL);
+                nmc_error_release(&error);
                 return EXIT_FAILURE;
+        }
 
-        if (getenv("NMC_DEBUG"))
-                nmc_grammar_debug = 1;
-
-        bool r = path == NULL ? convert_stdin() : convert_path(path);
+        // NOTE Several FILEs are converted in parallel, while a single FILE
+        // is split into parts that are parsed, and written, in parallel.
+        size_t n = argc - optind;
+        bool r;
+        if (n == 0)
+                r = convert_stdin(&context, &format);
+#ifdef HAVE_PTHREAD
+        else if (jobs > 1 && n > 1)
+                r = convert_paths_parallel(&context, &format, argv + optind, n,
+                                           directory, jobs > n ? n : jobs);
+#endif
+        else
+                r = convert_paths(&context, &format, argv + optind, n, directory,
+                                  n == 1 ? jobs : 1);
 
-        nmc_finalize();
+        nmc_context_release(&context);
 
         return r ? EXIT_SUCCESS : EXIT_FAILURE;
 }
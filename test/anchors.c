@@ -0,0 +1,122 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+#include <nmc/list.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static const char *const superscripts[] = {
+        "⁰", "¹", "²", "³", "⁴", "⁵", "⁶", "⁷", "⁸", "⁹",
+};
+
+static bool
+append_id(struct buffer *buffer, size_t i)
+{
+        char digits[24];
+        int n = snprintf(digits, sizeof(digits), "%zu", i + 1);
+        for (int j = 0; j < n; j++) {
+                const char *s = superscripts[digits[j] - '0'];
+                if (!buffer_append(buffer, s, strlen(s)))
+                        return false;
+        }
+        return true;
+}
+
+static bool
+append(struct buffer *buffer, const char *s)
+{
+        return buffer_append(buffer, s, strlen(s));
+}
+
+// NOTE Each of the sections has anchors anchors, each with its own id, in
+// a paragraph, followed by their definitions, in reverse order, so that
+// matching them up in a list would take quadratic time.
+static void
+document(struct buffer *buffer, size_t sections, size_t anchors)
+{
+        buffer->length = 0;
+        bool ok = append(buffer, "Title\n");
+        for (size_t i = 0; ok && i < sections; i++) {
+                ok = append(buffer, "\n§ Section\n\n   ");
+                for (size_t j = 0; ok && j < anchors; j++)
+                        ok = append(buffer, j % 8 == 7 ? "\n    word" : " word") &&
+                                append_id(buffer, j);
+                ok = ok && append(buffer, "\n\n");
+                for (size_t j = anchors; ok && j > 0; j--)
+                        ok = append_id(buffer, j - 1) &&
+                                append(buffer, " See http://example.com/\n");
+        }
+        if (!ok) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+}
+
+static struct nmc_document *
+parse(const struct nmc_context *context, const struct buffer *buffer)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context, buffer->content,
+                                               buffer->length,
+                                               NMC_PARSE_REFERENCE_INPUT,
+                                               &errors);
+        if (doc == NULL) {
+                list_for_each(struct nmc_parser_error, p, errors) {
+                        char *s = nmc_location_str(&p->location);
+                        fprintf(stderr, "%s: %s\n", s != NULL ? s : "?", p->message);
+                        free(s);
+                }
+                nmc_parser_error_free(errors);
+                failures++;
+        }
+        return doc;
+}
+
+static void
+benchmark(const struct nmc_context *context)
+{
+        static const size_t sizes[] = { 10, 100, 1000, 10000 };
+        struct buffer buffer = BUFFER_INIT;
+        for (size_t i = 0; i < lengthof(sizes); i++) {
+                size_t sections = 10000 / sizes[i];
+                document(&buffer, sections, sizes[i]);
+                size_t passes = 0;
+                double start = now(), elapsed;
+                do {
+                        nmc_document_free(parse(context, &buffer));
+                        passes++;
+                } while ((elapsed = now() - start) < 0.5);
+                printf("%5zu anchors per section %8.1f ms %8.3f µs per anchor\n",
+                       sizes[i], elapsed / passes * 1e3,
+                       elapsed / passes / (sections * sizes[i]) * 1e6);
+        }
+        free(buffer.content);
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        test_arguments(argc, argv, &benchmarking, "", 0, 0);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        struct buffer buffer = BUFFER_INIT;
+        for (size_t anchors = 1; anchors <= 300; anchors += anchors / 2 + 1) {
+                document(&buffer, 3, anchors);
+                nmc_document_free(parse(&context, &buffer));
+        }
+        free(buffer.content);
+        if (benchmarking)
+                benchmark(&context);
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,327 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <arena.h>
+#include <buffer.h>
+
+#include "helpers.h"
+
+// NOTE Allocations are counted by interposing malloc() and friends, which
+// pass them on to the C library’s own.  The C library uses them too, so
+// what it allocates for the parser, like asprintf() strings, is counted.
+// Without __libc_malloc(), nothing is counted and the checks that depend
+// on counts are skipped.
+static size_t allocations;
+static size_t live;
+
+#ifdef HAVE___LIBC_MALLOC
+#  define COUNTING true
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void __libc_free(void *p);
+
+void *
+malloc(size_t size)
+{
+        void *p = __libc_malloc(size);
+        if (p != NULL) {
+                allocations++;
+                live++;
+        }
+        return p;
+}
+
+void *
+calloc(size_t n, size_t size)
+{
+        void *p = __libc_calloc(n, size);
+        if (p != NULL) {
+                allocations++;
+                live++;
+        }
+        return p;
+}
+
+void *
+realloc(void *p, size_t size)
+{
+        void *q = __libc_realloc(p, size);
+        if (p == NULL && q != NULL) {
+                allocations++;
+                live++;
+        } else if (p != NULL && q == NULL && size == 0)
+                live--;
+        else if (q != NULL)
+                allocations++;
+        return q;
+}
+
+void
+free(void *p)
+{
+        if (p != NULL)
+                live--;
+        __libc_free(p);
+}
+#else
+#  define COUNTING false
+#endif
+
+#define ALIGNMENT alignof(max_align_t)
+
+static void
+fail(const char *test, const char *message)
+{
+        fprintf(stderr, "%s: %s\n", test, message);
+        failures++;
+}
+
+static struct nmc_arena *
+arena_new(void)
+{
+        struct nmc_arena *arena = nmc_arena_new();
+        if (arena == NULL) {
+                perror("nmc_arena_new");
+                exit(EXIT_FAILURE);
+        }
+        return arena;
+}
+
+// NOTE An arena that nothing was allocated from is one block, which
+// freeing it releases.  Freeing NULL does nothing.
+static void
+empty(void)
+{
+        size_t before = live, allocated = allocations;
+        struct nmc_arena *arena = arena_new();
+        size_t blocks = allocations - allocated;
+        nmc_arena_free(arena);
+        nmc_arena_free(NULL);
+        if (COUNTING && blocks != 1)
+                fail("empty", "more than one block allocated");
+        if (COUNTING && live != before)
+                fail("empty", "blocks not freed");
+}
+
+struct allocation {
+        unsigned char *p;
+        size_t size;
+};
+
+static PURE bool
+intact(const struct allocation *a)
+{
+        for (size_t i = 0; i < a->size; i++)
+                if (a->p[i] != (unsigned char)a->size)
+                        return false;
+        return true;
+}
+
+// NOTE Objects of all small sizes, with strings in between them, which
+// are taken from the other end of the block, are aligned and don’t
+// overlap, over enough of them to fill several blocks.
+static void
+alignment(void)
+{
+        struct nmc_arena *arena = arena_new();
+        static struct allocation allocated[4096];
+        char string[256];
+        memset(string, 'x', sizeof(string));
+        for (size_t i = 0; i < lengthof(allocated); i++) {
+                size_t size = i % 200;
+                unsigned char *p;
+                if (i % 3 == 2) {
+                        p = (unsigned char *)nmc_arena_strndup(arena, string,
+                                                               size % sizeof(string));
+                        if (p != NULL && strlen((char *)p) != size % sizeof(string))
+                                fail("alignment", "string not terminated");
+                } else {
+                        p = nmc_arena_alloc(arena, size);
+                        if (p != NULL && (uintptr_t)p % ALIGNMENT != 0)
+                                fail("alignment", "object not aligned");
+                }
+                if (p == NULL) {
+                        perror("nmc_arena_alloc");
+                        exit(EXIT_FAILURE);
+                }
+                memset(p, (unsigned char)size, size);
+                allocated[i] = (struct allocation){ p, size };
+        }
+        for (size_t i = 0; i < lengthof(allocated); i++)
+                if (!intact(&allocated[i])) {
+                        fail("alignment", "allocations overlap");
+                        break;
+                }
+        nmc_arena_free(arena);
+}
+
+// NOTE Fills the current block of arena up until size bytes, as an object
+// or a string, no longer fit in it, and checks that they then get a block
+// of their own, through alloc_slow(), which leaves the block current, so
+// that what comes next is right after, or for strings right before, what
+// came from it last.
+static void
+large_one(struct nmc_arena *arena, const char *string, size_t size, bool top)
+{
+        size_t rounded = (16 + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        char *a, *s, *p;
+        size_t allocated;
+        do {
+                a = nmc_arena_alloc(arena, 16);
+                s = nmc_arena_strndup(arena, "s", 1);
+                allocated = allocations;
+                p = top ? nmc_arena_strndup(arena, string, size) :
+                        nmc_arena_alloc(arena, size);
+                if (a == NULL || s == NULL || p == NULL) {
+                        perror("nmc_arena_alloc");
+                        exit(EXIT_FAILURE);
+                }
+        } while (top ? p == s - (size + 1) : p == a + rounded);
+        if (COUNTING && allocations - allocated != 1)
+                fail("large", "not in a block of its own");
+        if (top ? strlen(p) != size || memcmp(p, string, size) != 0 :
+            (uintptr_t)p % ALIGNMENT != 0)
+                fail("large", top ? "string not copied" : "object not aligned");
+        if (!top)
+                memset(p, 0xa5, size);
+        allocated = allocations;
+        if (nmc_arena_alloc(arena, 16) != a + rounded ||
+            nmc_arena_strndup(arena, "u", 1) != s - 2)
+                fail("large", "current block not kept");
+        if (COUNTING && allocations != allocated)
+                fail("large", "current block not kept");
+}
+
+// NOTE Releasing to a mark taken before large allocations frees their
+// blocks, and those that filling the current block took.
+static void
+large(void)
+{
+        static const size_t sizes[] = { 20000, 65536, 1 << 20 };
+        char *string = malloc(1 << 20);
+        if (string == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        memset(string, 'x', 1 << 20);
+        struct nmc_arena *arena = arena_new();
+        struct nmc_arena_mark mark = nmc_arena_mark(arena);
+        size_t before = live;
+        for (size_t i = 0; i < lengthof(sizes); i++) {
+                large_one(arena, string, sizes[i], false);
+                large_one(arena, string, sizes[i], true);
+        }
+        nmc_arena_release(arena, mark);
+        if (COUNTING && live != before)
+                fail("large", "release didn’t free the blocks");
+        nmc_arena_free(arena);
+        free(string);
+}
+
+// NOTE Everything a parse allocates is freed with its document, whether
+// text is copied into the arena or referenced.
+static void
+parse(const struct nmc_context *context, const char *path,
+      const struct buffer *input)
+{
+        static const unsigned int flags[] = { 0, NMC_PARSE_REFERENCE_INPUT };
+        for (size_t i = 0; i < lengthof(flags); i++) {
+                size_t before = live;
+                struct nmc_parser_error *errors;
+                struct nmc_document *doc = nmc_parse_n(context, input->content,
+                                                       input->length, flags[i],
+                                                       &errors);
+                if (doc == NULL) {
+                        nmc_parser_error_free(errors);
+                        fail(path, "can’t be parsed");
+                }
+                nmc_document_free(doc);
+                if (COUNTING && live != before)
+                        fail(path, "not everything allocated was freed");
+        }
+}
+
+#define BENCHMARK_SIZE (16 * 1024 * 1024)
+
+// NOTE Parses FILE, followed by its top-level sections repeated to 16 MiB,
+// and frees the document, timing each and counting what the parse
+// allocates.
+static void
+benchmark(const struct nmc_context *context, const char *path,
+          const struct buffer *file)
+{
+        struct buffer input = BUFFER_INIT;
+        if (!repeat(&input, file, BENCHMARK_SIZE)) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        size_t passes = 0, counted = 0;
+        double parsing = 0, freeing = 0;
+        do {
+                struct nmc_parser_error *errors;
+                size_t allocated = allocations;
+                double start = now();
+                struct nmc_document *doc = nmc_parse_n(context, input.content,
+                                                       input.length, 0,
+                                                       &errors);
+                double parsed = now();
+                counted = allocations - allocated;
+                if (doc == NULL) {
+                        nmc_parser_error_free(errors);
+                        fail(path, "can’t be parsed");
+                        break;
+                }
+                nmc_document_free(doc);
+                freeing += now() - parsed;
+                parsing += parsed - start;
+                passes++;
+        } while (parsing + freeing < 0.5);
+        if (passes > 0) {
+                printf("%s: %zu KiB, ", path, input.length >> 10);
+                if (COUNTING)
+                        printf("%zu allocations, ", counted);
+                printf("parse %8.3f ms, free %8.3f ms\n",
+                       parsing / passes * 1e3, freeing / passes * 1e3);
+        }
+        free(input.content);
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "FILE...", 1,
+                                   INT_MAX);
+        empty();
+        alignment();
+        large();
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        for (int i = first; i < argc; i++) {
+                struct buffer input = BUFFER_INIT;
+                if (!read_file(&input, argv[i])) {
+                        perror(argv[i]);
+                        return EXIT_FAILURE;
+                }
+                parse(&context, argv[i], &input);
+                if (benchmarking)
+                        benchmark(&context, argv[i], &input);
+                free(input.content);
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
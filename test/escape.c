@@ -0,0 +1,141 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+#include <escape.h>
+
+#include "helpers.h"
+
+typedef const char *(*find_fn)(const char *, const char *, bool);
+
+static const struct variant {
+        const char *name;
+        find_fn find;
+} variants[] = {
+        { "scalar", escape_find_scalar },
+#ifdef HAVE_SSE2
+        { "sse2", escape_find_sse2 },
+#endif
+#ifdef HAVE_AVX2
+        { "avx2", escape_find_avx2 },
+#endif
+        { "dispatch", escape_find },
+};
+
+static bool
+supported(const struct variant *variant)
+{
+#ifdef HAVE_AVX2
+        if (variant->find == escape_find_avx2)
+                return __builtin_cpu_supports("avx2");
+#else
+        (void)variant;
+#endif
+        return true;
+}
+
+static void
+compare(const char *p, const char *end, bool attribute)
+{
+        for (const char *q = p; ; q++) {
+                const char *expected = escape_find_scalar(q, end, attribute);
+                for (size_t i = 1; i < lengthof(variants); i++) {
+                        if (!supported(&variants[i]))
+                                continue;
+                        const char *actual = variants[i].find(q, end, attribute);
+                        if (actual != expected) {
+                                fprintf(stderr, "%s: %s found %td instead of %td in "
+                                        "%td bytes\n", variants[i].name,
+                                        attribute ? "attribute" : "text",
+                                        actual - q, expected - q, end - q);
+                                failures++;
+                        }
+                }
+                if (expected == end)
+                        break;
+                q = expected;
+        }
+}
+
+// NOTE Put every byte value at every position of blocks straddling one
+// and two vector widths, then compare on random inputs made mostly of
+// specials and their neighbours.
+static void
+differential(void)
+{
+        char b[96];
+        for (size_t n = 0; n <= 80; n++)
+                for (size_t i = 0; i < n; i++)
+                        for (int c = 0; c < 256; c++) {
+                                memset(b, 'a', sizeof(b));
+                                b[i] = (char)c;
+                                compare(b, b + n, false);
+                                compare(b, b + n, true);
+                        }
+
+        static const char alphabet[] = "&<>\"\t\n\r=?;:%'a\x80\xff";
+        srand(1);
+        for (int i = 0; i < 100000; i++) {
+                size_t n = (size_t)rand() % sizeof(b);
+                for (size_t j = 0; j < n; j++)
+                        b[j] = rand() % 8 == 0 ?
+                                alphabet[(size_t)rand() % (sizeof(alphabet) - 1)] :
+                                (char)(rand() % 256);
+                size_t o = n > 0 ? (size_t)rand() % n : 0;
+                compare(b + o, b + n, i % 2 == 0);
+        }
+}
+
+static void
+benchmark(const char *path)
+{
+        struct buffer file = BUFFER_INIT;
+        if (!read_file(&file, path) || buffer_cstr(&file) == NULL) {
+                perror(path);
+                exit(EXIT_FAILURE);
+        }
+        const char *s = file.content, *end = s + file.length;
+        compare(s, end, false);
+        compare(s, end, true);
+
+        for (size_t i = 0; i < lengthof(variants); i++) {
+                if (!supported(&variants[i]))
+                        continue;
+                for (int attribute = 0; attribute < 2; attribute++) {
+                        size_t specials = 0, passes = 0;
+                        double start = now(), elapsed;
+                        do {
+                                for (const char *p = s;
+                                     (p = variants[i].find(p, end, attribute)) < end;
+                                     p++)
+                                        specials++;
+                                passes++;
+                        } while ((elapsed = now() - start) < 0.5);
+                        printf("%-8s %-9s %8.0f MB/s (%zu specials)\n",
+                               variants[i].name,
+                               attribute ? "attribute" : "text",
+                               passes * (double)file.length / elapsed / 1e6,
+                               specials / passes);
+                }
+        }
+        free(file.content);
+}
+
+int
+main(int argc, char **argv)
+{
+        int first = test_arguments(argc, argv, NULL, "[FILE]", 0, 1);
+        differential();
+        if (first < argc)
+                benchmark(argv[first]);
+        return test_status(argv[0]);
+}
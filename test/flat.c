@@ -0,0 +1,283 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdalign.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, const char *message)
+{
+        fprintf(stderr, "%s: %s\n", path, message);
+        failures++;
+}
+
+struct event {
+        enum nmc_node_name name;
+        bool enter;
+};
+
+struct events {
+        struct event *events;
+        size_t n;
+        size_t size;
+};
+
+static bool
+record(struct events *events, struct nmc_node *node, bool enter)
+{
+        if (events->n == events->size) {
+                size_t size = events->size == 0 ? 64 : 2 * events->size;
+                struct event *e = realloc(events->events, size * sizeof(*e));
+                if (e == NULL)
+                        return false;
+                events->events = e;
+                events->size = size;
+        }
+        events->events[events->n++] = (struct event){ node->name, enter };
+        return true;
+}
+
+static bool
+record_enter(struct nmc_node *node, struct events *events)
+{
+        return record(events, node, true);
+}
+
+static bool
+record_leave(struct nmc_node *node, struct events *events)
+{
+        return record(events, node, false);
+}
+
+// NOTE The iterator must visit the nodes in the same order, entering and
+// leaving them, as nmc_node_traverse() does the tree it was built from.
+static void
+compare_traversals(const char *path, struct nmc_node *root,
+                   const struct nmc_flat_document *flat)
+{
+        struct events events = { NULL, 0, 0 };
+        struct nmc_error error;
+        if (!nmc_node_traverse(root, (nmc_node_traverse_fn)record_enter,
+                               (nmc_node_traverse_fn)record_leave, &events,
+                               &error)) {
+                fail(path, "traversal failed");
+                free(events.events);
+                return;
+        }
+        struct nmc_flat_iterator iterator;
+        if (!nmc_flat_iterator_init(&iterator, flat, &error)) {
+                fail(path, error.message);
+                nmc_error_release(&error);
+                free(events.events);
+                return;
+        }
+        size_t n = 0;
+        uint32_t i;
+        bool enter;
+        while (nmc_flat_iterator_next(&iterator, &i, &enter) &&
+               n < events.n && events.events[n].name == flat->nodes[i].name &&
+               events.events[n].enter == enter)
+                n++;
+        if (n != events.n || nmc_flat_iterator_next(&iterator, &i, &enter))
+                fail(path, "iterator visits nodes in a different order");
+        nmc_flat_iterator_release(&iterator);
+        free(events.events);
+}
+
+static char *
+xml(const struct nmc_context *context, struct nmc_node *root,
+    const struct nmc_flat_document *flat)
+{
+        struct buffer_output output;
+        buffer_output_init(&output);
+        struct nmc_error error;
+        if (!(flat != NULL ?
+              nmc_flat_xml(context, flat, &output.output, &error) :
+              nmc_node_xml(context, root, &output.output, &error))) {
+                nmc_error_release(&error);
+                free(output.buffer.content);
+                return NULL;
+        }
+        return buffer_str(&output.buffer);
+}
+
+static inline size_t
+arena_size(size_t size)
+{
+        return (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+}
+
+// NOTE Counts what the nodes of the pointer tree take up in the arena, not
+// counting text, which references the input.
+static bool
+tree_size_enter(struct nmc_node *node, size_t *size)
+{
+        switch (node->type) {
+        case NMC_NODE_TYPE_PARENT:
+                *size += arena_size(sizeof(struct nmc_parent_node));
+                break;
+        case NMC_NODE_TYPE_DATA: {
+                size_t n = 1;
+                for (struct nmc_node_datum *p = ((struct nmc_data_node *)node)->data;
+                     p->name != NULL; p++)
+                        n++;
+                *size += arena_size(sizeof(struct nmc_data_node)) +
+                        arena_size(n * sizeof(struct nmc_node_datum));
+                break;
+        }
+        case NMC_NODE_TYPE_TEXT:
+                *size += arena_size(sizeof(struct nmc_text_node));
+                for (struct nmc_text *p = ((struct nmc_text_node *)node)->text.next;
+                     p != NULL; p = p->next)
+                        *size += arena_size(sizeof(struct nmc_text));
+                break;
+        default:
+                break;
+        }
+        return true;
+}
+
+struct timing {
+        double traverse;
+        double xml;
+};
+
+static void
+time_tree(const struct nmc_context *context, struct nmc_node *root,
+          const struct nmc_flat_document *flat, struct timing *timing)
+{
+        char b[65536];
+        struct nmc_output null;
+        null_output_init(&null);
+        struct nmc_error error;
+        size_t passes = 0;
+        double start = now(), elapsed;
+        do {
+                if (flat != NULL) {
+                        struct nmc_flat_iterator iterator;
+                        if (!nmc_flat_iterator_init(&iterator, flat, &error))
+                                exit(EXIT_FAILURE);
+                        uint32_t i;
+                        bool enter;
+                        while (nmc_flat_iterator_next(&iterator, &i, &enter))
+                                ;
+                        nmc_flat_iterator_release(&iterator);
+                } else {
+                        nmc_node_traverse(root, nmc_node_traverse_null,
+                                          nmc_node_traverse_null, NULL, &error);
+                }
+                passes++;
+        } while ((elapsed = now() - start) < 0.5);
+        timing->traverse = elapsed / passes;
+
+        passes = 0;
+        start = now();
+        do {
+                struct nmc_buffered_output output;
+                nmc_buffered_output_init(&output, &null, b, sizeof(b));
+                if (!(flat != NULL ?
+                      nmc_flat_xml(context, flat, &output.output, &error) :
+                      nmc_node_xml(context, root, &output.output, &error)) ||
+                    !nmc_output_close(&output.output, &error))
+                        exit(EXIT_FAILURE);
+                passes++;
+        } while ((elapsed = now() - start) < 0.5);
+        timing->xml = elapsed / passes;
+}
+
+static void
+benchmark(const struct nmc_context *context, const char *path,
+          const struct buffer *input, struct nmc_node *root,
+          const struct nmc_flat_document *flat)
+{
+        size_t tree = 0;
+        struct nmc_error error;
+        nmc_node_traverse(root, (nmc_node_traverse_fn)tree_size_enter,
+                          nmc_node_traverse_null, &tree, &error);
+        size_t size = flat->n * sizeof(struct nmc_flat_node);
+        for (size_t i = 0; i < flat->n; i++)
+                if (flat->nodes[i].type == NMC_NODE_TYPE_DATA)
+                        for (const struct nmc_node_datum *p = flat->data + flat->nodes[i].offset;
+                             ; p++) {
+                                size += sizeof(*p);
+                                if (p->name == NULL)
+                                        break;
+                        }
+
+        struct timing pointers, flattened;
+        time_tree(context, root, NULL, &pointers);
+        time_tree(context, root, flat, &flattened);
+        printf("%s: %zu KiB, %zu nodes\n"
+               "  tree  %9zu bytes  traverse %8.3f ms  xml %8.3f ms\n"
+               "  flat  %9zu bytes  traverse %8.3f ms  xml %8.3f ms\n",
+               path, input->length >> 10, flat->n,
+               tree, pointers.traverse * 1e3, pointers.xml * 1e3,
+               size, flattened.traverse * 1e3, flattened.xml * 1e3);
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "FILE...", 1,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        for (int i = first; i < argc; i++) {
+                const char *path = argv[i];
+                struct buffer input = BUFFER_INIT;
+                if (!read_file(&input, path)) {
+                        perror(path);
+                        return EXIT_FAILURE;
+                }
+                struct nmc_parser_error *errors;
+                struct nmc_document *doc = nmc_parse_n(&context, input.content,
+                                                       input.length,
+                                                       NMC_PARSE_REFERENCE_INPUT,
+                                                       &errors);
+                if (doc == NULL) {
+                        nmc_parser_error_free(errors);
+                        fail(path, "can’t be parsed");
+                        free(input.content);
+                        continue;
+                }
+                struct nmc_error error;
+                struct nmc_flat_document *flat = nmc_flat_document_new(doc->root,
+                                                                       &error);
+                if (flat == NULL) {
+                        fail(path, error.message);
+                        nmc_error_release(&error);
+                } else {
+                        compare_traversals(path, doc->root, flat);
+                        char *expected = xml(&context, doc->root, NULL);
+                        char *actual = xml(&context, doc->root, flat);
+                        if (expected == NULL || actual == NULL ||
+                            strcmp(expected, actual) != 0)
+                                fail(path, "XML output differs");
+                        free(actual);
+                        free(expected);
+                        if (benchmarking)
+                                benchmark(&context, path, &input, doc->root, flat);
+                        nmc_flat_document_free(flat);
+                }
+                nmc_document_free(doc);
+                free(input.content);
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
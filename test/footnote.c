@@ -0,0 +1,215 @@
+#include <config.h>
+
+#include <regex.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+#include <footnote.h>
+
+#include "helpers.h"
+
+typedef bool (*match_fn)(const char *, size_t, struct footnote_capture *);
+
+// NOTE The regular expressions that the matchers replaced and the groups
+// that correspond to their captures.  A link’s title is the sixth group,
+// if set, and otherwise the fourth.
+static struct definition {
+        const char *name;
+        const char *pattern;
+        match_fn match;
+        int groups[3];
+        regex_t regex;
+} definitions[] = {
+        { "abbreviation", "^Abbreviation +for +(.+)",
+          footnote_abbreviation, { 1, 0, 0 }, { 0 } },
+        { "figure", "^(.+), +see +([^ ]+)( +\\((.+)\\))?",
+          footnote_inline_figure, { 1, 2, 4 }, { 0 } },
+        { "link", "^(See +((the +)?(.+)(:| +at) +)?|(.+)(:| +at) +)([^ ]+)",
+          footnote_link, { 6, 8, 0 }, { 0 } },
+};
+
+static void
+compare(const char *s)
+{
+        size_t n = strlen(s);
+        for (size_t i = 0; i < lengthof(definitions); i++) {
+                struct definition *d = &definitions[i];
+                regmatch_t matches[10];
+                struct footnote_capture captures[3];
+                bool expected = regexec(&d->regex, s, lengthof(matches),
+                                        matches, 0) == 0;
+                bool actual = d->match(s, n, captures);
+                if (actual != expected) {
+                        fprintf(stderr, "%s: “%s” %s\n", d->name, s,
+                                expected ? "didn’t match" : "matched");
+                        failures++;
+                        continue;
+                } else if (!expected)
+                        continue;
+                for (size_t j = 0; j < lengthof(d->groups) && d->groups[j] > 0; j++) {
+                        regmatch_t *m = &matches[d->groups[j]];
+                        if (d->match == footnote_link && j == 0 && m->rm_so == -1)
+                                m = &matches[4];
+                        struct footnote_capture *c = &captures[j];
+                        if ((m->rm_so == -1) != (c->string == NULL) ||
+                            (c->string != NULL &&
+                             (c->string - s != m->rm_so ||
+                              (regoff_t)c->length != m->rm_eo - m->rm_so))) {
+                                fprintf(stderr, "%s: “%s” captured “%.*s” "
+                                        "instead of “%.*s” for group %d\n",
+                                        d->name, s,
+                                        c->string != NULL ? (int)c->length : 0,
+                                        c->string != NULL ? c->string : "",
+                                        m->rm_so != -1 ?
+                                        (int)(m->rm_eo - m->rm_so) : 0,
+                                        m->rm_so != -1 ? s + m->rm_so : "",
+                                        d->groups[j]);
+                                failures++;
+                        }
+                }
+        }
+}
+
+// NOTE Compare on random strings built out of the words and separators
+// that the expressions look for, so that the interesting cases, like
+// several separators, spaces at the ends, and missing titles, come up.
+static void
+differential(void)
+{
+        static const char *const words[] = {
+                " ", " ", " ", "  ", "See", "see", "the", "at", ":", ",",
+                "(", ")", "x", "Abbreviation", "for", "a", "t", "S", "\n",
+        };
+        char b[1024];
+        srand(1);
+        for (int i = 0; i < 500000; i++) {
+                size_t n = 0;
+                for (int j = rand() % 24; j > 0; j--) {
+                        const char *w = words[(size_t)rand() % lengthof(words)];
+                        size_t length = strlen(w);
+                        memcpy(b + n, w, length);
+                        n += length;
+                }
+                b[n] = '\0';
+                compare(b);
+        }
+}
+
+static bool
+match_regex(const char *s, UNUSED(size_t n), struct definition *d)
+{
+        regmatch_t matches[10];
+        return regexec(&d->regex, s, lengthof(matches), matches, 0) == 0;
+}
+
+static bool
+match_matcher(const char *s, size_t n, struct definition *d)
+{
+        struct footnote_capture captures[3];
+        return d->match(s, n, captures);
+}
+
+// NOTE Treats every line of the file as footnote content and, like the
+// parser, tries each definition in turn until one matches.
+static void
+benchmark(const char *path)
+{
+        FILE *file = fopen(path, "rb");
+        if (file == NULL) {
+                perror(path);
+                exit(EXIT_FAILURE);
+        }
+        size_t n = 0, allocated = 0, bytes = 0;
+        char **lines = NULL, *line = NULL;
+        size_t size = 0;
+        ssize_t length;
+        while ((length = getline(&line, &size, file)) != -1) {
+                if (length > 0 && line[length - 1] == '\n')
+                        line[--length] = '\0';
+                if (n == allocated) {
+                        allocated = allocated == 0 ? 256 : 2 * allocated;
+                        lines = realloc(lines, allocated * sizeof(*lines));
+                        if (lines == NULL) {
+                                perror(path);
+                                exit(EXIT_FAILURE);
+                        }
+                }
+                if ((lines[n++] = strdup(line)) == NULL) {
+                        perror(path);
+                        exit(EXIT_FAILURE);
+                }
+                bytes += length;
+        }
+        free(line);
+        fclose(file);
+        for (size_t i = 0; i < n; i++)
+                compare(lines[i]);
+
+        static const struct {
+                const char *name;
+                bool (*match)(const char *, size_t, struct definition *);
+        } variants[] = {
+                { "regex", match_regex },
+                { "matcher", match_matcher },
+        };
+        for (size_t v = 0; v < lengthof(variants); v++) {
+                size_t matched = 0, passes = 0;
+                double start = now(), elapsed;
+                do {
+                        for (size_t i = 0; i < n; i++)
+                                for (size_t j = 0; j < lengthof(definitions); j++)
+                                        if (variants[v].match(lines[i],
+                                                              strlen(lines[i]),
+                                                              &definitions[j])) {
+                                                matched++;
+                                                break;
+                                        }
+                        passes++;
+                } while ((elapsed = now() - start) < 0.5);
+                printf("%-8s %8.1f MB/s %10.0f lines/s (%zu of %zu matched)\n",
+                       variants[v].name, passes * (double)bytes / elapsed / 1e6,
+                       passes * (double)n / elapsed, matched / passes, n);
+        }
+
+        size_t passes = 0;
+        double start = now(), elapsed;
+        do {
+                regex_t regexes[lengthof(definitions)];
+                for (size_t i = 0; i < lengthof(definitions); i++)
+                        regcomp(&regexes[i], definitions[i].pattern, REG_EXTENDED);
+                for (size_t i = 0; i < lengthof(definitions); i++)
+                        regfree(&regexes[i]);
+                passes++;
+        } while ((elapsed = now() - start) < 0.5);
+        printf("regcomp  %8.1f µs for all definitions\n", elapsed / passes * 1e6);
+
+        for (size_t i = 0; i < n; i++)
+                free(lines[i]);
+        free(lines);
+}
+
+int
+main(int argc, char **argv)
+{
+        int first = test_arguments(argc, argv, NULL, "[FILE]", 0, 1);
+        for (size_t i = 0; i < lengthof(definitions); i++)
+                if (regcomp(&definitions[i].regex, definitions[i].pattern,
+                            REG_EXTENDED) != 0) {
+                        fprintf(stderr, "%s: can’t compile %s expression\n",
+                                argv[0], definitions[i].name);
+                        return EXIT_FAILURE;
+                }
+        differential();
+        if (first < argc)
+                benchmark(argv[first]);
+        for (size_t i = 0; i < lengthof(definitions); i++)
+                regfree(&definitions[i].regex);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,213 @@
+#include <config.h>
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include <nmc.h>
+#include <nmc/list.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+size_t failures;
+
+int
+test_arguments(int argc, char **argv, bool *benchmarking, const char *usage,
+               int minimum, int maximum)
+{
+        int first = 1;
+        if (benchmarking != NULL) {
+                *benchmarking = argc > 1 && strcmp(argv[1], "--benchmark") == 0;
+                first += *benchmarking;
+        }
+        if (argc - first < minimum || argc - first > maximum) {
+                fprintf(stderr, "Usage: %s%s%s%s\n", argv[0],
+                        benchmarking != NULL ? " [--benchmark]" : "",
+                        *usage != '\0' ? " " : "", usage);
+                exit(EXIT_FAILURE);
+        }
+        return first;
+}
+
+int
+test_status(const char *program)
+{
+        if (failures > 0) {
+                fprintf(stderr, "%s: %zu failures\n", program, failures);
+                return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+}
+
+static ssize_t
+buffer_output_write(struct buffer_output *output, const char *string,
+                    size_t length, struct nmc_error *error)
+{
+        if (!buffer_append(&output->buffer, string, length)) {
+                nmc_error_oom(error);
+                return -1;
+        }
+        return length;
+}
+
+void
+buffer_output_init(struct buffer_output *output)
+{
+        nmc_output_init(&output->output,
+                        (nmc_output_write_fn)buffer_output_write, NULL);
+        output->buffer = (struct buffer)BUFFER_INIT;
+}
+
+static CONST ssize_t
+null_output_write(UNUSED(struct nmc_output *output), UNUSED(const char *string),
+                  size_t length, UNUSED(struct nmc_error *error))
+{
+        return length;
+}
+
+void
+null_output_init(struct nmc_output *output)
+{
+        nmc_output_init(output, null_output_write, NULL);
+}
+
+bool
+read_file(struct buffer *buffer, const char *path)
+{
+        FILE *file = fopen(path, "rb");
+        if (file == NULL)
+                return false;
+        char b[4096];
+        size_t n;
+        while ((n = fread(b, 1, sizeof(b), file)) > 0)
+                if (!buffer_append(buffer, b, n)) {
+                        fclose(file);
+                        return false;
+                }
+        return !ferror(file) & (fclose(file) == 0);
+}
+
+bool
+append_errors(struct buffer *buffer, const struct nmc_parser_error *errors)
+{
+        list_for_each(const struct nmc_parser_error, p, errors) {
+                char *s = nmc_location_str(&p->location);
+                bool r = s != NULL &&
+                        buffer_append(buffer, s, strlen(s)) &&
+                        buffer_append(buffer, ": ", 2) &&
+                        buffer_append(buffer, p->message, strlen(p->message)) &&
+                        buffer_append(buffer, "\n", 1);
+                free(s);
+                if (!r)
+                        return false;
+        }
+        return true;
+}
+
+char *
+result(const struct nmc_context *context, struct nmc_node *root,
+       struct nmc_parser_error *errors)
+{
+        struct buffer_output output;
+        buffer_output_init(&output);
+        bool r = true;
+        if (root != NULL) {
+                struct nmc_error error;
+                if (!nmc_node_xml(context, root, &output.output, &error)) {
+                        nmc_error_release(&error);
+                        r = false;
+                }
+        }
+        r = r && append_errors(&output.buffer, errors);
+        nmc_parser_error_free(errors);
+        if (!r) {
+                free(output.buffer.content);
+                return NULL;
+        }
+        return buffer_str(&output.buffer);
+}
+
+char *
+document_result(const struct nmc_context *context, struct nmc_document *doc,
+                struct nmc_parser_error *errors)
+{
+        char *s = result(context, doc != NULL ? doc->root : NULL, errors);
+        nmc_document_free(doc);
+        return s;
+}
+
+bool
+repeat(struct buffer *output, const struct buffer *input, size_t size)
+{
+        if (!buffer_append(output, input->content, input->length))
+                return false;
+        const char *sections = strstr(input->content, "\n§ ");
+        if (sections == NULL)
+                return true;
+        sections++;
+        size_t n = input->content + input->length - sections;
+        while (output->length < size)
+                if (!buffer_append(output, sections, n))
+                        return false;
+        return true;
+}
+
+double
+now(void)
+{
+        struct timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+char *
+generate_reference(size_t sections, size_t size, size_t *length)
+{
+        static const char title[] = "Generated reference\n";
+        static const char head[] =
+                "\n"
+                "§ Section\n"
+                "\n";
+        static const char paragraph[] =
+                "    The function described in this section takes two\n"
+                "    arguments and returns their sum, or reports an error¹,\n"
+                "    as described in ‹error.h› and in /the manual/.\n"
+                "\n";
+        static const char tail[] =
+                "  ¹ See the error reference at http://example.com/errors\n";
+        size_t paragraphs = (size / sections) / (sizeof(paragraph) - 1);
+        if (paragraphs == 0)
+                paragraphs = 1;
+        size_t section = sizeof(head) - 1 +
+                paragraphs * (sizeof(paragraph) - 1) + sizeof(tail) - 1;
+        *length = sizeof(title) - 1 + sections * section;
+        char *input = malloc(*length);
+        if (input == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        char *p = input;
+        memcpy(p, title, sizeof(title) - 1);
+        p += sizeof(title) - 1;
+        for (size_t i = 0; i < sections; i++) {
+                memcpy(p, head, sizeof(head) - 1);
+                p += sizeof(head) - 1;
+                for (size_t j = 0; j < paragraphs; j++) {
+                        memcpy(p, paragraph, sizeof(paragraph) - 1);
+                        p += sizeof(paragraph) - 1;
+                }
+                memcpy(p, tail, sizeof(tail) - 1);
+                p += sizeof(tail) - 1;
+        }
+        return input;
+}
@@ -0,0 +1,52 @@
+// NOTE The number of failures that a test has found so far.
+extern size_t failures;
+
+// NOTE Parses the arguments of a test, --benchmark first, if benchmarking
+// isn’t NULL, and then operands, described by usage, of which there must be
+// from minimum to maximum, and exits with usage if they’re wrong.  Returns
+// the index of the first operand.
+int test_arguments(int argc, char **argv, bool *benchmarking,
+                   const char *usage, int minimum, int maximum);
+
+// NOTE Reports the failures, if there were any, and returns the status to
+// exit with.
+int test_status(const char *program);
+
+// NOTE An output that appends what’s written to it to a buffer.
+struct buffer_output {
+        struct nmc_output output;
+        struct buffer buffer;
+};
+
+void buffer_output_init(struct buffer_output *output);
+
+// NOTE An output that throws away what’s written to it.
+void null_output_init(struct nmc_output *output);
+
+bool read_file(struct buffer *buffer, const char *path);
+
+// NOTE Appends errors to buffer, one per line.
+bool append_errors(struct buffer *buffer, const struct nmc_parser_error *errors);
+
+// NOTE Renders the result of a parse, the tree, if there is one, as XML,
+// followed by the errors, one per line, so that two parses can be compared
+// as strings.  The errors are freed.
+char *result(const struct nmc_context *context, struct nmc_node *root,
+             struct nmc_parser_error *errors);
+
+// NOTE Renders the result of a parse like result() does and frees doc.
+char *document_result(const struct nmc_context *context,
+                      struct nmc_document *doc,
+                      struct nmc_parser_error *errors);
+
+double now(void);
+
+// NOTE Appends input to output, followed by its top-level sections over
+// and over again, until there are at least size bytes, for inputs that
+// must be large.
+bool repeat(struct buffer *output, const struct buffer *input, size_t size);
+
+// NOTE Generates a reference of about size bytes, split into sections of
+// about the same size, where each paragraph has a footnote anchor, defined
+// at the end of the section that it’s in.
+char *generate_reference(size_t sections, size_t size, size_t *length);
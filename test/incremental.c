@@ -0,0 +1,285 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, size_t edit, const char *message)
+{
+        fprintf(stderr, "%s: edit %zu: %s\n", path, edit, message);
+        failures++;
+}
+
+// NOTE An incremental parser and a copy of its text, which is parsed in
+// full after each edit to compare against.
+struct session {
+        const struct nmc_context *context;
+        const char *path;
+        struct nmc_incremental *incremental;
+        struct buffer text;
+        size_t edits;
+};
+
+static bool
+buffer_edit(struct buffer *buffer, size_t offset, size_t removed,
+            const char *inserted, size_t length)
+{
+        size_t n = buffer->length - offset - removed;
+        if (length > removed &&
+            !buffer_append(buffer, inserted, length - removed))
+                return false;
+        memmove(buffer->content + offset + length,
+                buffer->content + offset + removed, n);
+        memcpy(buffer->content + offset, inserted, length);
+        buffer->length = offset + length + n;
+        return true;
+}
+
+// NOTE Returns whether the text as edited parses.
+static bool
+edit(struct session *session, size_t offset, size_t removed,
+     const char *inserted, size_t length)
+{
+        session->edits++;
+        if (!buffer_edit(&session->text, offset, removed, inserted, length)) {
+                perror(session->path);
+                exit(EXIT_FAILURE);
+        }
+        struct nmc_parser_error *errors;
+        struct nmc_node *root = nmc_incremental_edit(session->incremental,
+                                                     offset, removed, inserted,
+                                                     length, &errors);
+        char *actual = result(session->context, root, errors);
+        struct nmc_document *doc = nmc_parse_n(session->context,
+                                               session->text.content,
+                                               session->text.length,
+                                               NMC_PARSE_REFERENCE_INPUT,
+                                               &errors);
+        char *expected = result(session->context,
+                                doc != NULL ? doc->root : NULL, errors);
+        bool parsed = doc != NULL;
+        nmc_document_free(doc);
+        if (expected == NULL || actual == NULL)
+                fail(session->path, session->edits, "can’t be parsed");
+        else if (strcmp(expected, actual) != 0)
+                fail(session->path, session->edits, "result differs");
+        free(expected);
+        free(actual);
+        return parsed;
+}
+
+// NOTE Insertions are picked to join and split sections and paragraphs,
+// change indentation, and add and remove footnotes and their anchors, as
+// well as to put in errors that later edits may take out again.
+static const char *const insertions[] = {
+        "", "x", "word ", "\n", "\n\n", "    ", "  ", "§ ", "\n§ Section\n\n",
+        "\n§ Section\n\n    Text¹.\n\n  ¹ A footnote\n", "¹", "²",
+        "\n  ¹ A footnote\n", "‹", "›", "/", "  •   ", "\n  •   An item\n",
+        "\xc2",
+};
+
+// NOTE Every other edit is at the beginning of a top-level section, where
+// regions may begin and end, and half of the removals end there instead.
+static size_t
+random_offset(const struct buffer *text)
+{
+        size_t offset = (size_t)rand() % (text->length + 1);
+        if (rand() % 2 == 0)
+                return offset;
+        const char *p = text->content + offset;
+        const char *end = text->content + text->length;
+        while ((p = memchr(p, '\n', end - p)) != NULL) {
+                p++;
+                if (end - p >= 2 && memcmp(p, "§", 2) == 0)
+                        return p - text->content - rand() % 2;
+        }
+        return offset;
+}
+
+// NOTE Random edits that make the text fail to parse are undone again, as
+// are some of those that don’t, so that most edits are made to a text that
+// parses.
+static void
+check(const struct nmc_context *context, const char *path,
+      const struct buffer *input, size_t edits)
+{
+        struct session session = {
+                context, path, nmc_incremental_new(context, 0), BUFFER_INIT, 0
+        };
+        if (session.incremental == NULL) {
+                fail(path, 0, "out of memory");
+                return;
+        }
+        edit(&session, 0, 0, input->content, input->length);
+        while (session.edits < edits) {
+                size_t offset = random_offset(&session.text);
+                size_t removed = 0;
+                if (rand() % 2 == 0) {
+                        removed = rand() % 4 == 0 ? (size_t)rand() % 256 :
+                                (size_t)rand() % 4;
+                        if (rand() % 2 == 0 && offset >= removed)
+                                offset -= removed;
+                        if (removed > session.text.length - offset)
+                                removed = session.text.length - offset;
+                }
+                const char *inserted;
+                size_t length;
+                if (rand() % 8 == 0 && input->length > 0) {
+                        size_t at = (size_t)rand() % input->length;
+                        inserted = input->content + at;
+                        length = (size_t)rand() % 256;
+                        if (length > input->length - at)
+                                length = input->length - at;
+                } else {
+                        inserted = insertions[(size_t)rand() %
+                                              lengthof(insertions)];
+                        length = strlen(inserted);
+                }
+                char *saved = malloc(removed + 1);
+                if (saved == NULL) {
+                        perror(path);
+                        exit(EXIT_FAILURE);
+                }
+                memcpy(saved, session.text.content + offset, removed);
+                if (!edit(&session, offset, removed, inserted, length) ||
+                    rand() % 4 == 0)
+                        edit(&session, offset, length, saved, removed);
+                free(saved);
+        }
+        free(session.text.content);
+        nmc_incremental_free(session.incremental);
+}
+
+static int
+compare_doubles(const void *a, const void *b)
+{
+        double x = *(const double *)a, y = *(const double *)b;
+        return (x > y) - (x < y);
+}
+
+#define BENCHMARK_SIZE (5 * 1024 * 1024)
+#define KEYSTROKES 1000
+
+// NOTE Types a character at the beginning of a word somewhere in the
+// document and then deletes it again, and compares how long each keystroke takes to parsing
+// the whole document from scratch.
+static void
+benchmark(const struct nmc_context *context)
+{
+        printf("%9s %10s %12s %12s %12s %12s\n", "sections", "input KiB",
+               "full", "median", "99th", "slowest");
+        for (size_t sections = 10; sections <= 10000; sections *= 10) {
+                size_t length;
+                char *input = generate_reference(sections, BENCHMARK_SIZE,
+                                                 &length);
+                struct nmc_incremental *incremental =
+                        nmc_incremental_new(context, 0);
+                struct nmc_parser_error *errors;
+                if (incremental == NULL ||
+                    nmc_incremental_edit(incremental, 0, 0, input, length,
+                                         &errors) == NULL) {
+                        fail("generated", 0, "can’t be parsed");
+                        nmc_incremental_free(incremental);
+                        free(input);
+                        continue;
+                }
+                double full = 0;
+                for (int pass = 0; pass < 5; pass++) {
+                        double start = now();
+                        struct nmc_document *doc = nmc_parse_n(context, input,
+                                                               length, 0,
+                                                               &errors);
+                        double t = now() - start;
+                        full = pass == 0 || t < full ? t : full;
+                        nmc_parser_error_free(errors);
+                        nmc_document_free(doc);
+                }
+                static double times[KEYSTROKES];
+                for (size_t i = 0; i < KEYSTROKES; i += 2) {
+                        size_t at = (size_t)rand() % length;
+                        while (at > 0 && (input[at - 1] != ' ' ||
+                                          input[at] < 'a' || input[at] > 'z'))
+                                at--;
+                        double start = now();
+                        struct nmc_node *root =
+                                nmc_incremental_edit(incremental, at, 0, "x",
+                                                     1, &errors);
+                        times[i] = now() - start;
+                        if (root == NULL) {
+                                nmc_parser_error_free(errors);
+                                fail("generated", i, "can’t be parsed");
+                        }
+                        start = now();
+                        root = nmc_incremental_edit(incremental, at, 1, "", 0,
+                                                    &errors);
+                        times[i + 1] = now() - start;
+                        if (root == NULL) {
+                                nmc_parser_error_free(errors);
+                                fail("generated", i + 1, "can’t be parsed");
+                        }
+                }
+                qsort(times, KEYSTROKES, sizeof(*times), compare_doubles);
+                printf("%9zu %10zu %9.2f ms %9.3f ms %9.3f ms %9.3f ms\n",
+                       sections, length >> 10, full * 1e3,
+                       times[KEYSTROKES / 2] * 1e3,
+                       times[KEYSTROKES * 99 / 100] * 1e3,
+                       times[KEYSTROKES - 1] * 1e3);
+                nmc_incremental_free(incremental);
+                free(input);
+        }
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "[FILE...]", 0,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        srand(1);
+        if (benchmarking) {
+                benchmark(&context);
+        } else {
+                // NOTE Sections larger than regions begin one each, so
+                // that edits at the beginning of a section are at the
+                // beginning of a region.
+                size_t length;
+                char *input = generate_reference(6, 256 * 1024, &length);
+                struct buffer b = { length, length, input };
+                check(&context, "generated", &b, 400);
+                free(input);
+                for (int i = first; i < argc; i++) {
+                        const char *path = argv[i];
+                        struct buffer file = BUFFER_INIT;
+                        b = (struct buffer)BUFFER_INIT;
+                        if (!read_file(&file, path) ||
+                            buffer_cstr(&file) == NULL ||
+                            !repeat(&b, &file, 256 * 1024)) {
+                                perror(path);
+                                return EXIT_FAILURE;
+                        }
+                        check(&context, path, &file, 200);
+                        check(&context, path, &b, 200);
+                        free(b.content);
+                        free(file.content);
+                }
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,210 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, size_t length, size_t threads, const char *message)
+{
+        fprintf(stderr, "%s: first %zu bytes, %zu threads: %s\n", path, length,
+                threads, message);
+        failures++;
+}
+
+static void
+check(const struct nmc_context *context, const char *path, const char *input,
+      size_t length)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context, input, length,
+                                               NMC_PARSE_REFERENCE_INPUT,
+                                               &errors);
+        char *expected = document_result(context, doc, errors);
+        if (expected == NULL) {
+                fail(path, length, 1, "can’t be parsed");
+                return;
+        }
+        static const size_t threads[] = { 2, 3, 8 };
+        for (size_t i = 0; i < lengthof(threads); i++) {
+                doc = nmc_parse_parallel(context, input, length,
+                                         NMC_PARSE_REFERENCE_INPUT, threads[i],
+                                         &errors);
+                char *actual = document_result(context, doc, errors);
+                if (actual == NULL)
+                        fail(path, length, threads[i], "can’t be parsed");
+                else if (strcmp(expected, actual) != 0)
+                        fail(path, length, threads[i], "result differs");
+                free(actual);
+        }
+        free(expected);
+}
+
+// NOTE Errors are put in each part in turn, as an unterminated code
+// inline, which continues into the next part, a section tag without a
+// space, which isn’t a place to split at, and an undefined footnote.
+static void
+check_errors(const struct nmc_context *context, const char *path,
+             const struct buffer *input)
+{
+        static const char *const errors[] = { "‹", "\n§x", "⁹" };
+        for (size_t i = 0; i < 16; i++) {
+                size_t at = (size_t)rand() % input->length;
+                while (at > 0 && input->content[at - 1] != ' ')
+                        at--;
+                struct buffer b = BUFFER_INIT;
+                const char *error = errors[i % lengthof(errors)];
+                if (!buffer_append(&b, input->content, at) ||
+                    !buffer_append(&b, error, strlen(error)) ||
+                    !buffer_append(&b, input->content + at,
+                                   input->length - at)) {
+                        free(b.content);
+                        fail(path, input->length, 1, "out of memory");
+                        return;
+                }
+                check(context, path, b.content, b.length);
+                free(b.content);
+        }
+}
+
+#define ALIGNED_SIZE (64 * 1024)
+
+// NOTE The title block and each top-level section are ALIGNED_SIZE bytes,
+// so that for two threads the input is split exactly where sections
+// begin, and a short section follows them, which is left over at the end.
+static char *
+aligned(size_t sections, size_t *length)
+{
+        static const char *const heads[] = { "Aligned\n\n", "§ Section\n\n" };
+        static const char tail[] = "§ End\n";
+        *length = (sections + 1) * ALIGNED_SIZE + sizeof(tail) - 1;
+        char *input = malloc(*length);
+        if (input == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        char *p = input;
+        for (size_t i = 0; i <= sections; i++, p += ALIGNED_SIZE) {
+                size_t n = strlen(heads[i > 0]);
+                memcpy(p, heads[i > 0], n);
+                memset(p + n, ' ', 4);
+                memset(p + n + 4, 'x', ALIGNED_SIZE - n - 6);
+                memcpy(p + ALIGNED_SIZE - 2, "\n\n", 2);
+        }
+        memcpy(p, tail, sizeof(tail) - 1);
+        return input;
+}
+
+static double
+time_parse(const struct nmc_context *context, const char *input,
+           size_t length, size_t threads)
+{
+        double best = 0;
+        for (int pass = 0; pass < 5; pass++) {
+                struct nmc_parser_error *errors;
+                double start = now();
+                struct nmc_document *doc =
+                        threads == 0 ?
+                        nmc_parse_n(context, input, length,
+                                    NMC_PARSE_REFERENCE_INPUT, &errors) :
+                        nmc_parse_parallel(context, input, length,
+                                           NMC_PARSE_REFERENCE_INPUT, threads,
+                                           &errors);
+                double t = now() - start;
+                best = pass == 0 || t < best ? t : best;
+                if (doc == NULL) {
+                        nmc_parser_error_free(errors);
+                        fail("generated", length, threads, "can’t be parsed");
+                }
+                nmc_document_free(doc);
+        }
+        return best;
+}
+
+#define BENCHMARK_SIZE (8 * 1024 * 1024)
+
+static void
+benchmark(const struct nmc_context *context)
+{
+        static const size_t threads[] = { 2, 4, 8 };
+        printf("%9s %10s %12s", "sections", "input KiB", "sequential");
+        for (size_t i = 0; i < lengthof(threads); i++)
+                printf("  %2zu threads", threads[i]);
+        printf("\n");
+        for (size_t sections = 10; sections <= 10000; sections *= 10) {
+                size_t length;
+                char *input = generate_reference(sections, BENCHMARK_SIZE,
+                                                 &length);
+                double sequential = time_parse(context, input, length, 0);
+                printf("%9zu %10zu %9.1f ms", sections, length >> 10,
+                       sequential * 1e3);
+                for (size_t i = 0; i < lengthof(threads); i++)
+                        printf("  %9.2fx", sequential /
+                               time_parse(context, input, length, threads[i]));
+                printf("\n");
+                free(input);
+        }
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "[FILE...]", 0,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        srand(1);
+        if (benchmarking) {
+                benchmark(&context);
+        } else {
+                size_t length;
+                char *input = generate_reference(100, 1024 * 1024, &length);
+                check(&context, "generated", input, length);
+                free(input);
+                input = aligned(7, &length);
+                check(&context, "aligned", input, length);
+                free(input);
+                for (int i = first; i < argc; i++) {
+                        const char *path = argv[i];
+                        struct buffer file = BUFFER_INIT, b = BUFFER_INIT;
+                        if (!read_file(&file, path) ||
+                            buffer_cstr(&file) == NULL ||
+                            !repeat(&b, &file, 512 * 1024)) {
+                                perror(path);
+                                return EXIT_FAILURE;
+                        }
+                        // NOTE Prefixes of the input end in all kinds of
+                        // places, and many of them fail to parse, but most
+                        // of those that end at the end of a line don’t.
+                        for (size_t n = 0; n < b.length; n += b.length / 29 + 1) {
+                                check(&context, path, b.content, n);
+                                const char *eol = memchr(b.content + n, '\n',
+                                                         b.length - n);
+                                if (eol != NULL)
+                                        check(&context, path, b.content,
+                                              eol + 1 - b.content);
+                        }
+                        check(&context, path, b.content, b.length);
+                        check_errors(&context, path, &b);
+                        free(b.content);
+                        free(file.content);
+                }
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
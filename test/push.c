@@ -0,0 +1,213 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, size_t length, const char *chunking,
+     const char *message)
+{
+        fprintf(stderr, "%s: first %zu bytes, %s: %s\n", path, length, chunking,
+                message);
+        failures++;
+}
+
+// NOTE Feeds input in chunks of at most chunk bytes, or of random sizes up
+// to that if random is set, which puts chunk boundaries in the middle of
+// characters and of tokens.
+static char *
+push(const struct nmc_context *context, const char *input, size_t length,
+     size_t chunk, bool random)
+{
+        struct nmc_parser *parser = nmc_parser_new(context, 0);
+        if (parser == NULL)
+                return NULL;
+        for (size_t i = 0; i < length; ) {
+                size_t n = random ? 1 + (size_t)rand() % chunk : chunk;
+                if (n > length - i)
+                        n = length - i;
+                if (!nmc_parser_feed(parser, input + i, n))
+                        break;
+                i += n;
+        }
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parser_finish(parser, &errors);
+        return document_result(context, doc, errors);
+}
+
+static void
+check(const struct nmc_context *context, const char *path, const char *input,
+      size_t length)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context, input, length, 0,
+                                               &errors);
+        char *expected = document_result(context, doc, errors);
+        if (expected == NULL) {
+                fail(path, length, "whole", "can’t be parsed");
+                return;
+        }
+        static const struct {
+                const char *name;
+                size_t chunk;
+                bool random;
+        } chunkings[] = {
+                { "byte by byte", 1, false },
+                { "random chunks up to 16 bytes", 16, true },
+                { "random chunks up to 4 KiB", 4096, true },
+        };
+        for (size_t i = 0; i < lengthof(chunkings); i++) {
+                char *actual = push(context, input, length, chunkings[i].chunk,
+                                    chunkings[i].random);
+                if (actual == NULL)
+                        fail(path, length, chunkings[i].name, "can’t be parsed");
+                else if (strcmp(expected, actual) != 0)
+                        fail(path, length, chunkings[i].name, "result differs");
+                free(actual);
+        }
+        free(expected);
+}
+
+static void
+append(struct buffer *b, const char *string)
+{
+        if (!buffer_append(b, string, strlen(string))) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+}
+
+// NOTE Generates a section with a code block, with some blank lines in it,
+// and a footnote that each are about size bytes long, but a single token.
+static void
+generate_large_tokens(struct buffer *b, size_t size)
+{
+        append(b, "Large tokens\n"
+                  "\n"
+                  "§ Section\n"
+                  "\n"
+                  "    A paragraph with a footnote¹.\n"
+                  "\n");
+        for (size_t n = b->length + size, i = 0; b->length < n; i++)
+                append(b, i % 16 == 15 ? "\n" : "      total += add(i, 1);\n");
+        append(b, "\n"
+                  "  ¹ A footnote whose title\n");
+        for (size_t n = b->length + size; b->length < n; )
+                append(b, "    goes on and on for many lines\n");
+        append(b, "    at http://example.com/\n");
+}
+
+static void
+wait_until(double t)
+{
+        double d;
+        while ((d = t - now()) > 0) {
+                struct timespec s = { (time_t)d, (long)((d - (time_t)d) * 1e9) };
+                nanosleep(&s, NULL);
+        }
+}
+
+#define BENCHMARK_CHUNK 65536
+#define BENCHMARK_RATE (64.0 * 1024 * 1024)
+
+// NOTE Simulates a producer, like a pipe from a slow process, that makes
+// a chunk of input available at a fixed rate, and measures the time from
+// the first chunk until the document is parsed, when it’s parsed once all
+// input has arrived and when each chunk is fed to a push parser as it
+// arrives.
+static void
+benchmark(const struct nmc_context *context, const char *path,
+          const struct buffer *input)
+{
+        double whole = 0, pushed = 0, produce = 0;
+        for (int pass = 0; pass < 5; pass++) {
+                struct nmc_parser_error *errors;
+                double start = now(), arrived = start;
+                for (size_t i = 0; i < input->length; i += BENCHMARK_CHUNK)
+                        wait_until(arrived = start + (i + BENCHMARK_CHUNK) / BENCHMARK_RATE);
+                produce = arrived - start;
+                struct nmc_document *doc = nmc_parse_n(context, input->content,
+                                                       input->length, 0, &errors);
+                double t = now() - start;
+                whole = pass == 0 || t < whole ? t : whole;
+                nmc_document_free(doc);
+                nmc_parser_error_free(errors);
+
+                start = now();
+                struct nmc_parser *parser = nmc_parser_new(context, 0);
+                if (parser == NULL)
+                        exit(EXIT_FAILURE);
+                for (size_t i = 0; i < input->length; i += BENCHMARK_CHUNK) {
+                        size_t n = input->length - i < BENCHMARK_CHUNK ?
+                                input->length - i : BENCHMARK_CHUNK;
+                        wait_until(start + (i + BENCHMARK_CHUNK) / BENCHMARK_RATE);
+                        nmc_parser_feed(parser, input->content + i, n);
+                }
+                doc = nmc_parser_finish(parser, &errors);
+                t = now() - start;
+                pushed = pass == 0 || t < pushed ? t : pushed;
+                nmc_document_free(doc);
+                nmc_parser_error_free(errors);
+        }
+        printf("%s: %zu KiB arriving over %.1f ms\n"
+               "  parse when read  %8.1f ms\n"
+               "  push as read     %8.1f ms\n",
+               path, input->length >> 10, produce * 1e3, whole * 1e3,
+               pushed * 1e3);
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "FILE...", 1,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        srand(1);
+        for (int i = first; i < argc; i++) {
+                const char *path = argv[i];
+                struct buffer input = BUFFER_INIT;
+                if (!read_file(&input, path)) {
+                        perror(path);
+                        return EXIT_FAILURE;
+                }
+                if (benchmarking) {
+                        benchmark(&context, path, &input);
+                } else {
+                        // NOTE Prefixes of the file end in all kinds of
+                        // places, and many of them fail to parse.
+                        for (size_t n = 0; n < input.length; n += input.length / 29 + 1)
+                                check(&context, path, input.content, n);
+                        check(&context, path, input.content, input.length);
+                }
+                free(input.content);
+        }
+        // NOTE A code block or footnote, however long, is a single token,
+        // and must not be lexed again from its beginning for each chunk.
+        struct buffer large = BUFFER_INIT;
+        generate_large_tokens(&large, benchmarking ? 4 * 1024 * 1024 : 16 * 1024);
+        if (benchmarking)
+                benchmark(&context, "large tokens", &large);
+        else
+                check(&context, "large tokens", large.content, large.length);
+        free(large.content);
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,264 @@
+#include <config.h>
+
+#include <limits.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, size_t threads, const char *message)
+{
+        fprintf(stderr, "%s: %zu threads: %s\n", path, threads, message);
+        failures++;
+}
+
+// NOTE Serializes node with threads threads, or with nmc_node_xml() if
+// threads is 0, into a string.
+static char *
+serialize(const struct nmc_context *context, struct nmc_node *node,
+          size_t threads)
+{
+        struct buffer_output output;
+        buffer_output_init(&output);
+        struct nmc_error error;
+        if (!(threads == 0 ?
+              nmc_node_xml(context, node, &output.output, &error) :
+              nmc_node_xml_parallel(context, node, threads, &output.output,
+                                    &error))) {
+                nmc_error_release(&error);
+                free(output.buffer.content);
+                return NULL;
+        }
+        return buffer_str(&output.buffer);
+}
+
+// NOTE Serializes node with threads threads through a buffered output to a
+// file, which is written to with writev, and reads it back.
+static char *
+serialize_file(const struct nmc_context *context, struct nmc_node *node,
+               size_t threads)
+{
+        FILE *file = tmpfile();
+        if (file == NULL)
+                return NULL;
+        struct nmc_fd_output fd;
+        nmc_fd_output_init(&fd, fileno(file));
+        char b[4096];
+        struct nmc_buffered_output output;
+        nmc_buffered_output_init(&output, &fd.output, b, sizeof(b));
+        struct nmc_error error;
+        if (!(nmc_node_xml_parallel(context, node, threads, &output.output,
+                                    &error) &&
+              nmc_output_flush(&output.output, &error))) {
+                nmc_error_release(&error);
+                fclose(file);
+                return NULL;
+        }
+        struct buffer result = BUFFER_INIT;
+        rewind(file);
+        size_t n;
+        while ((n = fread(b, 1, sizeof(b), file)) > 0)
+                if (!buffer_append(&result, b, n))
+                        break;
+        fclose(file);
+        if (n > 0) {
+                free(result.content);
+                return NULL;
+        }
+        return buffer_str(&result);
+}
+
+static void
+check(const struct nmc_context *context, const char *path, const char *input,
+      size_t length)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context, input, length,
+                                               NMC_PARSE_REFERENCE_INPUT,
+                                               &errors);
+        if (doc == NULL) {
+                nmc_parser_error_free(errors);
+                fail(path, 0, "can’t be parsed");
+                return;
+        }
+        char *expected = serialize(context, doc->root, 0);
+        if (expected == NULL) {
+                fail(path, 0, "can’t be serialized");
+                nmc_document_free(doc);
+                return;
+        }
+        static const size_t threads[] = { 2, 3, 8 };
+        for (size_t i = 0; i < lengthof(threads); i++) {
+                char *actual = serialize(context, doc->root, threads[i]);
+                if (actual == NULL)
+                        fail(path, threads[i], "can’t be serialized");
+                else if (strcmp(expected, actual) != 0)
+                        fail(path, threads[i], "result differs");
+                free(actual);
+                actual = serialize_file(context, doc->root, threads[i]);
+                if (actual == NULL)
+                        fail(path, threads[i], "can’t be written to a file");
+                else if (strcmp(expected, actual) != 0)
+                        fail(path, threads[i], "file differs");
+                free(actual);
+        }
+        free(expected);
+        nmc_document_free(doc);
+}
+
+// NOTE Each section has a paragraph referring to a footnote, an
+// itemization, and a subsection, so that sections are of a fixed size.
+static char *
+generate(size_t sections, size_t *length)
+{
+        static const char title[] = "Generated reference\n";
+        static const char section[] =
+                "\n"
+                "§ Section\n"
+                "\n"
+                "    The function described in this section takes two\n"
+                "    arguments and returns their sum, or reports an error¹.\n"
+                "\n"
+                "  •   The first argument, which is <a> & “b”\n"
+                "  •   The second argument\n"
+                "\n"
+                "  § Examples\n"
+                "\n"
+                "      Adding ‹1› and ‹2› gives /3/.\n"
+                "\n"
+                "  ¹ See the error reference at http://example.com/errors\n";
+        *length = sizeof(title) - 1 + sections * (sizeof(section) - 1);
+        char *input = malloc(*length);
+        if (input == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        char *p = input;
+        memcpy(p, title, sizeof(title) - 1);
+        p += sizeof(title) - 1;
+        for (size_t i = 0; i < sections; i++, p += sizeof(section) - 1)
+                memcpy(p, section, sizeof(section) - 1);
+        return input;
+}
+
+// NOTE Returns the best of five runs, written to /dev/null through a
+// buffer, as the command-line tool writes to its output.
+static double
+time_serialize(const struct nmc_context *context, struct nmc_node *node,
+               size_t threads, int fd)
+{
+        double best = 0;
+        for (int pass = 0; pass < 5; pass++) {
+                struct nmc_fd_output null;
+                nmc_fd_output_init(&null, fd);
+                char b[65536];
+                struct nmc_buffered_output output;
+                nmc_buffered_output_init(&output, &null.output, b, sizeof(b));
+                struct nmc_error error;
+                double start = now();
+                if (!nmc_node_xml_parallel(context, node, threads,
+                                           &output.output, &error) ||
+                    !nmc_output_flush(&output.output, &error)) {
+                        nmc_error_release(&error);
+                        fail("generated", threads, "can’t be serialized");
+                }
+                double t = now() - start;
+                best = pass == 0 || t < best ? t : best;
+        }
+        return best;
+}
+
+static void
+benchmark(const struct nmc_context *context)
+{
+        int fd = open("/dev/null", O_WRONLY);
+        if (fd == -1) {
+                perror("/dev/null");
+                exit(EXIT_FAILURE);
+        }
+        static const size_t threads[] = { 1, 2, 4, 8 };
+        printf("%9s %10s", "sections", "output KiB");
+        for (size_t i = 0; i < lengthof(threads); i++)
+                printf("  %2zu threads", threads[i]);
+        printf("\n");
+        for (size_t sections = 100; sections <= 100000; sections *= 10) {
+                size_t length;
+                char *input = generate(sections, &length);
+                struct nmc_parser_error *errors;
+                struct nmc_document *doc =
+                        nmc_parse_n(context, input, length,
+                                    NMC_PARSE_REFERENCE_INPUT, &errors);
+                char *xml = doc != NULL ?
+                        serialize(context, doc->root, 0) : NULL;
+                if (xml == NULL) {
+                        nmc_parser_error_free(errors);
+                        fail("generated", 0, "can’t be serialized");
+                        nmc_document_free(doc);
+                        free(input);
+                        continue;
+                }
+                size_t size = strlen(xml);
+                free(xml);
+                printf("%9zu %10zu", sections, size >> 10);
+                for (size_t i = 0; i < lengthof(threads); i++)
+                        printf("  %5.0f MB/s", size / 1e6 /
+                               time_serialize(context, doc->root, threads[i],
+                                              fd));
+                printf("\n");
+                nmc_document_free(doc);
+                free(input);
+        }
+        close(fd);
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "[FILE...]", 0,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        if (benchmarking) {
+                benchmark(&context);
+        } else {
+                static const size_t sections[] = { 0, 1, 7, 8, 9, 100, 1000 };
+                for (size_t i = 0; i < lengthof(sections); i++) {
+                        size_t length;
+                        char *input = generate(sections[i], &length);
+                        check(&context, "generated", input, length);
+                        free(input);
+                }
+                for (int i = first; i < argc; i++) {
+                        const char *path = argv[i];
+                        struct buffer file = BUFFER_INIT, b = BUFFER_INIT;
+                        if (!read_file(&file, path) ||
+                            buffer_cstr(&file) == NULL ||
+                            !repeat(&b, &file, 512 * 1024)) {
+                                perror(path);
+                                return EXIT_FAILURE;
+                        }
+                        check(&context, path, file.content, file.length);
+                        check(&context, path, b.content, b.length);
+                        free(b.content);
+                        free(file.content);
+                }
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,231 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+static void
+fail(const char *path, size_t length, const char *message)
+{
+        fprintf(stderr, "%s: first %zu bytes: %s\n", path, length, message);
+        failures++;
+}
+
+static char *
+tree(const struct nmc_context *context, const char *input, size_t length)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context, input, length,
+                                               NMC_PARSE_REFERENCE_INPUT,
+                                               &errors);
+        return document_result(context, doc, errors);
+}
+
+// NOTE Renders the output followed by the errors, like result() does, but
+// what’s been written when parsing fails is incomplete, so only the errors
+// are compared then.
+static char *
+stream(const struct nmc_context *context, const char *input, size_t length)
+{
+        struct buffer_output output;
+        buffer_output_init(&output);
+        struct nmc_parser_error *errors;
+        struct nmc_error error;
+        if (!nmc_parse_xml(context, input, length, NMC_PARSE_REFERENCE_INPUT,
+                           &output.output, &errors, &error)) {
+                if (errors == NULL) {
+                        nmc_error_release(&error);
+                        free(output.buffer.content);
+                        return NULL;
+                }
+                output.buffer.length = 0;
+        }
+        bool r = append_errors(&output.buffer, errors);
+        nmc_parser_error_free(errors);
+        if (!r) {
+                free(output.buffer.content);
+                return NULL;
+        }
+        return buffer_str(&output.buffer);
+}
+
+static void
+check(const struct nmc_context *context, const char *path, const char *input,
+      size_t length)
+{
+        char *expected = tree(context, input, length);
+        char *actual = stream(context, input, length);
+        if (expected == NULL || actual == NULL)
+                fail(path, length, "can’t be parsed");
+        else if (strcmp(expected, actual) != 0)
+                fail(path, length, "result differs");
+        free(actual);
+        free(expected);
+}
+
+// NOTE Each section has a paragraph referring to a footnote, an
+// itemization, and a subsection, so that sections are of a fixed size.
+static char *
+generate(size_t sections, size_t *length)
+{
+        static const char title[] = "Generated reference\n";
+        static const char section[] =
+                "\n"
+                "§ Section\n"
+                "\n"
+                "    The function described in this section takes two\n"
+                "    arguments and returns their sum, or reports an error¹.\n"
+                "\n"
+                "  •   The first argument\n"
+                "  •   The second argument\n"
+                "\n"
+                "  § Examples\n"
+                "\n"
+                "      Adding ‹1› and ‹2› gives /3/.\n"
+                "\n"
+                "  ¹ See the error reference at http://example.com/errors\n";
+        *length = sizeof(title) - 1 + sections * (sizeof(section) - 1);
+        char *input = malloc(*length);
+        if (input == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        char *p = input;
+        memcpy(p, title, sizeof(title) - 1);
+        p += sizeof(title) - 1;
+        for (size_t i = 0; i < sections; i++, p += sizeof(section) - 1)
+                memcpy(p, section, sizeof(section) - 1);
+        return input;
+}
+
+static long
+max_rss(void)
+{
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+}
+
+// NOTE Runs in a child of its own, so that the peak resident set size
+// measured is that of this parse alone, less that of the input.
+static long
+measure(const struct nmc_context *context, size_t sections, bool streaming)
+{
+        int fds[2];
+        if (pipe(fds) == -1) {
+                perror("pipe");
+                exit(EXIT_FAILURE);
+        }
+        pid_t pid = fork();
+        if (pid == -1) {
+                perror("fork");
+                exit(EXIT_FAILURE);
+        }
+        if (pid == 0) {
+                close(fds[0]);
+                size_t length;
+                char *input = generate(sections, &length);
+                long base = max_rss();
+                char b[65536];
+                struct nmc_output null;
+                null_output_init(&null);
+                struct nmc_buffered_output output;
+                nmc_buffered_output_init(&output, &null, b, sizeof(b));
+                struct nmc_parser_error *errors = NULL;
+                struct nmc_error error;
+                bool r;
+                if (streaming) {
+                        r = nmc_parse_xml(context, input, length,
+                                          NMC_PARSE_REFERENCE_INPUT,
+                                          &output.output, &errors, &error);
+                } else {
+                        struct nmc_document *doc =
+                                nmc_parse_n(context, input, length,
+                                            NMC_PARSE_REFERENCE_INPUT, &errors);
+                        r = doc != NULL &&
+                                nmc_node_xml(context, doc->root, &output.output,
+                                             &error);
+                        nmc_document_free(doc);
+                }
+                r = r && nmc_output_close(&output.output, &error);
+                long peak = r ? max_rss() - base : -1;
+                _exit(write(fds[1], &peak, sizeof(peak)) == sizeof(peak) ?
+                      EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        close(fds[1]);
+        long peak = -1;
+        if (read(fds[0], &peak, sizeof(peak)) != sizeof(peak))
+                peak = -1;
+        close(fds[0]);
+        waitpid(pid, NULL, 0);
+        return peak;
+}
+
+static void
+benchmark(const struct nmc_context *context)
+{
+        printf("%9s %10s %14s %14s\n", "sections", "input KiB", "tree KiB",
+               "stream KiB");
+        for (size_t sections = 100; sections <= 100000; sections *= 10) {
+                size_t length;
+                free(generate(sections, &length));
+                long t = measure(context, sections, false);
+                long s = measure(context, sections, true);
+                if (t < 0 || s < 0) {
+                        fail("generated", length, "can’t be measured");
+                        continue;
+                }
+                printf("%9zu %10zu %14ld %14ld\n", sections, length >> 10, t, s);
+        }
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        int first = test_arguments(argc, argv, &benchmarking, "[FILE...]", 0,
+                                   INT_MAX);
+        struct nmc_context context;
+        nmc_context_init(&context, 0, NULL);
+        if (benchmarking) {
+                benchmark(&context);
+        } else {
+                size_t length;
+                char *input = generate(50, &length);
+                check(&context, "generated", input, length);
+                free(input);
+                for (int i = first; i < argc; i++) {
+                        const char *path = argv[i];
+                        struct buffer b = BUFFER_INIT;
+                        if (!read_file(&b, path)) {
+                                perror(path);
+                                return EXIT_FAILURE;
+                        }
+                        // NOTE Prefixes of the file end in all kinds of
+                        // places, and many of them fail to parse.
+                        for (size_t n = 0; n < b.length; n += b.length / 97 + 1)
+                                check(&context, path, b.content, n);
+                        check(&context, path, b.content, b.length);
+                        free(b.content);
+                }
+        }
+        nmc_context_release(&context);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,268 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+#include <structure.h>
+
+#include "helpers.h"
+
+typedef void (*index_fn)(struct structure_block *, const char *, const char *);
+
+static const struct variant {
+        const char *name;
+        index_fn index;
+} variants[] = {
+        { "scalar", structure_index_scalar },
+#ifdef HAVE_SSE2
+        { "sse2", structure_index_sse2 },
+#endif
+#ifdef HAVE_AVX2
+        { "avx2", structure_index_avx2 },
+#endif
+        { "dispatch", structure_index },
+};
+
+static bool
+supported(const struct variant *variant)
+{
+#ifdef HAVE_AVX2
+        if (variant->index == structure_index_avx2)
+                return __builtin_cpu_supports("avx2");
+#else
+        (void)variant;
+#endif
+        return true;
+}
+
+static struct structure_block *
+blocks_new(size_t n)
+{
+        struct structure_block *blocks =
+                malloc((n / STRUCTURE_BLOCK_SIZE + 1) * sizeof(*blocks));
+        if (blocks == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        return blocks;
+}
+
+static void
+compare_index(const char *p, const char *end)
+{
+        size_t n = (size_t)(end - p);
+        struct structure_block *expected = blocks_new(n), *actual = blocks_new(n);
+        structure_index_scalar(expected, p, end);
+        for (size_t i = 1; i < lengthof(variants); i++) {
+                if (!supported(&variants[i]))
+                        continue;
+                variants[i].index(actual, p, end);
+                for (size_t k = 0; k <= n / STRUCTURE_BLOCK_SIZE; k++)
+                        if (memcmp(&actual[k], &expected[k], sizeof(actual[k])) != 0) {
+                                fprintf(stderr, "%s: block %zu of %zu bytes differs\n",
+                                        variants[i].name, k, n);
+                                failures++;
+                        }
+        }
+        free(actual);
+        free(expected);
+}
+
+static bool
+is_in(const char *p, const char *end, unsigned int which)
+{
+        unsigned char c = p < end ? (unsigned char)*p : '\0';
+        return ((which & STRUCTURE_ENDS) && (c == '\0' || c == '\n')) ||
+                ((which & STRUCTURE_SPACES) && c == ' ') ||
+                ((which & STRUCTURE_NONSPACES) && c != ' ') ||
+                ((which & STRUCTURE_SPECIALS) &&
+                 (c == '\0' || c == '\n' || c == ' ' || c == '|' || c == '/' ||
+                  c == '{' || c == '}' || c >= 0x80));
+}
+
+static const unsigned int whiches[] = {
+        STRUCTURE_ENDS,
+        STRUCTURE_NONSPACES,
+        STRUCTURE_SPECIALS,
+        STRUCTURE_ENDS | STRUCTURE_SPACES,
+};
+
+static void
+check_find(struct structure *structure, const char *p, const char *q,
+           unsigned int which)
+{
+        const char *end = structure->end;
+        const char *expected = q;
+        while (!is_in(expected, end, which))
+                expected++;
+        const char *actual = structure_find(structure, q, which);
+        if (actual != expected) {
+                fprintf(stderr, "find %#x from %td of %td bytes with a window "
+                        "of %zu blocks found %td instead of %td\n",
+                        which, q - p, end - p, structure->window, actual - p,
+                        expected - p);
+                failures++;
+        }
+}
+
+// NOTE Compare structure_find() to looking at each byte, without an index
+// and with windows small enough to slide both ways, going through the
+// input in order and jumping around in it.
+static void
+compare_find(const char *p, const char *end)
+{
+        struct structure unindexed = { p, end, p, p, NULL, 0, 0, 0 };
+        static const size_t windows[] = { 1, 2, 3, STRUCTURE_WINDOW };
+        for (size_t w = 0; w <= lengthof(windows); w++) {
+                struct structure indexed;
+                struct structure *structure = &unindexed;
+                if (w < lengthof(windows)) {
+                        if (!structure_init(&indexed, p, end, windows[w])) {
+                                perror("malloc");
+                                exit(EXIT_FAILURE);
+                        }
+                        structure = &indexed;
+                }
+                for (size_t i = 0; i < lengthof(whiches); i++) {
+                        for (const char *q = p; q <= end; q++)
+                                check_find(structure, p, q, whiches[i]);
+                        for (int j = 0; j < 16; j++)
+                                check_find(structure, p,
+                                           p + (size_t)rand() % (size_t)(end - p + 1),
+                                           whiches[i]);
+                }
+                if (structure == &indexed)
+                        structure_release(&indexed);
+        }
+}
+
+// NOTE Extends the input piece by piece, as a push parser does, moving it
+// now and then, and searches what there is of it after each piece.
+static void
+compare_extend(const char *p, const char *end)
+{
+        size_t n = (size_t)(end - p);
+        char *copies[2] = { malloc(n + 1), malloc(n + 1) };
+        if (copies[0] == NULL || copies[1] == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        memcpy(copies[0], p, n);
+        memcpy(copies[1], p, n);
+        size_t window = 1 + (size_t)rand() % 3;
+        struct structure structure;
+        if (!structure_init(&structure, copies[0], copies[0], window)) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        int c = 0;
+        for (size_t length = 0; length < n; ) {
+                length += 1 + (size_t)rand() % (n - length);
+                if (rand() % 4 == 0)
+                        c = !c;
+                if (!structure_extend(&structure, copies[c], copies[c] + length)) {
+                        perror("realloc");
+                        exit(EXIT_FAILURE);
+                }
+                for (size_t i = 0; i < lengthof(whiches); i++)
+                        for (int j = 0; j < 8; j++)
+                                check_find(&structure, copies[c],
+                                           copies[c] + (size_t)rand() % (length + 1),
+                                           whiches[i]);
+        }
+        structure_release(&structure);
+        free(copies[1]);
+        free(copies[0]);
+}
+
+// NOTE Put every byte value at every position of inputs straddling one
+// and two blocks, then compare on random inputs made mostly of specials
+// and their neighbours.
+static void
+differential(void)
+{
+        char b[3 * STRUCTURE_BLOCK_SIZE];
+        for (size_t n = 0; n <= 2 * STRUCTURE_BLOCK_SIZE + 8; n++)
+                for (size_t i = 0; i < n; i++)
+                        for (int c = 0; c < 256; c++) {
+                                memset(b, 'a', sizeof(b));
+                                b[i] = (char)c;
+                                compare_index(b, b + n);
+                        }
+
+        static const char alphabet[] = "\n\n   \0|/{}z~.a\x80\xe2\xff";
+        srand(1);
+        for (int i = 0; i < 20000; i++) {
+                size_t n = (size_t)rand() % sizeof(b);
+                for (size_t j = 0; j < n; j++)
+                        b[j] = rand() % 4 != 0 ?
+                                alphabet[(size_t)rand() % (sizeof(alphabet) - 1)] :
+                                (char)(rand() % 256);
+                size_t o = n > 0 ? (size_t)rand() % n : 0;
+                compare_index(b + o, b + n);
+                compare_find(b + o, b + n);
+                compare_extend(b + o, b + n);
+        }
+}
+
+// NOTE Indexes FILE, repeated or cut short to each size, so that both
+// inputs that fit in the caches and ones that don’t are measured.
+static void
+benchmark(const char *path)
+{
+        struct buffer file = BUFFER_INIT;
+        if (!read_file(&file, path) || file.length == 0) {
+                fprintf(stderr, "%s: can’t read or is empty\n", path);
+                exit(EXIT_FAILURE);
+        }
+        const char *s = file.content;
+        size_t length = file.length;
+
+        static const size_t sizes[] = { 1 << 12, 1 << 16, 1 << 20, 1 << 24 };
+        for (size_t i = 0; i < lengthof(sizes); i++) {
+                size_t size = sizes[i];
+                char *input = malloc(size);
+                if (input == NULL) {
+                        perror("malloc");
+                        exit(EXIT_FAILURE);
+                }
+                for (size_t j = 0; j < size; j += length)
+                        memcpy(input + j, s,
+                               size - j < length ? size - j : length);
+                compare_index(input, input + size);
+                struct structure_block *blocks = blocks_new(size);
+                for (size_t j = 0; j < lengthof(variants); j++) {
+                        if (!supported(&variants[j]))
+                                continue;
+                        size_t passes = 0;
+                        double start = now(), elapsed;
+                        do {
+                                variants[j].index(blocks, input, input + size);
+                                passes++;
+                        } while ((elapsed = now() - start) < 0.5);
+                        printf("%-8s %8zu KiB %8.0f MB/s\n", variants[j].name,
+                               size >> 10, passes * (double)size / elapsed / 1e6);
+                }
+                free(blocks);
+                free(input);
+        }
+        free(file.content);
+}
+
+int
+main(int argc, char **argv)
+{
+        int first = test_arguments(argc, argv, NULL, "[FILE]", 0, 1);
+        differential();
+        if (first < argc)
+                benchmark(argv[first]);
+        return test_status(argv[0]);
+}
@@ -0,0 +1,121 @@
+#include <config.h>
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_PTHREAD
+#  include <pthread.h>
+#endif
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+
+#include "helpers.h"
+
+#define THREADS 8
+#define ITERATIONS 20
+
+struct document {
+        const char *path;
+        struct buffer input;
+        char *expected;
+};
+
+static char *
+convert(const struct nmc_context *context, struct document *document,
+        unsigned int flags)
+{
+        struct nmc_parser_error *errors;
+        struct nmc_document *doc = nmc_parse_n(context,
+                                               document->input.content,
+                                               document->input.length,
+                                               flags, &errors);
+        return document_result(context, doc, errors);
+}
+
+struct stress {
+        const struct nmc_context *context;
+        struct document *documents;
+        size_t n;
+        size_t thread;
+        size_t failures;
+};
+
+static void *
+stress(void *closure)
+{
+        struct stress *stress = closure;
+        for (size_t i = 0; i < ITERATIONS * stress->n; i++) {
+                struct document *document =
+                        &stress->documents[(stress->thread + i) % stress->n];
+                char *actual = convert(stress->context, document,
+                                       i % 2 == 0 ? NMC_PARSE_REFERENCE_INPUT : 0);
+                if (actual == NULL || strcmp(actual, document->expected) != 0)
+                        stress->failures++;
+                free(actual);
+        }
+        return NULL;
+}
+
+int
+main(int argc, char **argv)
+{
+#ifdef HAVE_PTHREAD
+        int first = test_arguments(argc, argv, NULL, "FILE...", 1, INT_MAX);
+
+        struct nmc_context context;
+        struct nmc_error error;
+        if (!nmc_context_init(&context, 0, &error)) {
+                fprintf(stderr, "%s: %s\n", argv[0], error.message);
+                return EXIT_FAILURE;
+        }
+
+        size_t n = argc - first;
+        struct document documents[n];
+        for (size_t i = 0; i < n; i++) {
+                documents[i].path = argv[first + i];
+                documents[i].input = (struct buffer)BUFFER_INIT;
+                if (!read_file(&documents[i].input, documents[i].path)) {
+                        perror(documents[i].path);
+                        return EXIT_FAILURE;
+                }
+                documents[i].expected = convert(&context, &documents[i], 0);
+                if (documents[i].expected == NULL) {
+                        fprintf(stderr, "%s: %s: conversion failed\n",
+                                argv[0], documents[i].path);
+                        return EXIT_FAILURE;
+                }
+        }
+
+        // NOTE All threads share the one context.
+        pthread_t threads[THREADS];
+        struct stress stresses[THREADS];
+        for (size_t i = 0; i < THREADS; i++) {
+                stresses[i] = (struct stress){ &context, documents, n, i, 0 };
+                if (pthread_create(&threads[i], NULL, stress, &stresses[i]) != 0) {
+                        fprintf(stderr, "%s: can’t create thread\n", argv[0]);
+                        return EXIT_FAILURE;
+                }
+        }
+        for (size_t i = 0; i < THREADS; i++) {
+                pthread_join(threads[i], NULL);
+                failures += stresses[i].failures;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+                free(documents[i].input.content);
+                free(documents[i].expected);
+        }
+        nmc_context_release(&context);
+
+        return test_status(argv[0]);
+#else
+        fprintf(stderr, "%s: no thread support\n", argv[0]);
+        return 77;
+#endif
+}
@@ -0,0 +1,136 @@
+#include <config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nmc.h>
+
+#include <private.h>
+
+#include <buffer.h>
+#include <unicode.h>
+
+#include "helpers.h"
+
+static const struct {
+        const char *string;
+        size_t width;
+} tests[] = {
+        { "", 0 },
+        { "a", 1 },
+        { "\t\n\x7f", 3 },
+        { "abcdefghijklmnopqrstuvwxyz", 26 },
+        { "é", 1 },
+        { "e\xcc\x81", 1 },                     // U+0301 COMBINING ACUTE ACCENT
+        { "\xc2\xad", 1 },                      // U+00AD SOFT HYPHEN
+        { "\xe2\x80\x8b", 0 },                  // U+200B ZERO WIDTH SPACE
+        { "\xe2\x80\x8d", 0 },                  // U+200D ZERO WIDTH JOINER
+        { "\xe1\x85\xa0", 0 },                  // U+1160 HANGUL JUNGSEONG FILLER
+        { "\xe1\x84\x80", 2 },                  // U+1100 HANGUL CHOSEONG KIYEOK
+        { "漢字", 4 },
+        { "かな", 4 },
+        { "ｆｕｌｌ", 8 },
+        { "\xe3\x80\xaa", 2 },                  // U+302A, both wide and a mark
+        { "\xf0\xa0\x80\x80", 2 },              // U+20000
+        { "\xf3\xa0\x80\x81", 0 },              // U+E0001 LANGUAGE TAG
+        { "\xf3\xa0\x84\x80", 0 },              // U+E0100 VARIATION SELECTOR-17
+        { "\xff", 1 },
+        { "abcdefgh漢ijklmnop", 18 },
+};
+
+static void
+check(void)
+{
+        for (size_t i = 0; i < lengthof(tests); i++) {
+                size_t actual = u_width(tests[i].string, strlen(tests[i].string));
+                if (actual != tests[i].width) {
+                        fprintf(stderr, "“%s” is %zu columns wide, not %zu\n",
+                                tests[i].string, actual, tests[i].width);
+                        failures++;
+                }
+        }
+}
+
+// NOTE Each sample is made up of random words from its pieces, separated by
+// spaces, so that it looks somewhat like running text.
+static char *
+sample(const char *const *pieces, size_t n, size_t size)
+{
+        char *s = malloc(size + 16);
+        if (s == NULL) {
+                perror("malloc");
+                exit(EXIT_FAILURE);
+        }
+        size_t length = 0;
+        while (length < size) {
+                for (int j = 2 + rand() % 6; j > 0; j--) {
+                        const char *piece = pieces[(size_t)rand() % n];
+                        size_t l = strlen(piece);
+                        if (length + l > size)
+                                break;
+                        memcpy(s + length, piece, l);
+                        length += l;
+                }
+                s[length++] = ' ';
+        }
+        s[size] = '\0';
+        return s;
+}
+
+static void
+benchmark(void)
+{
+        static const char *const latin[] = {
+                "a", "e", "i", "o", "n", "t", "s", "r", "h", "l", "é", "ü",
+        };
+        static const char *const cjk[] = {
+                "漢", "字", "日", "本", "語", "中", "文", "か", "な", "カ",
+                "ナ", "한", "글",
+        };
+        static const char *const combining[] = {
+                "a", "e", "o", "a\xcc\x81", "e\xcc\x88", "o\xcc\x83",
+                "\xe0\xa4\x95\xe0\xa5\x8d", "\xd7\x91\xd6\xbc",
+        };
+        static const char *const mixed[] = {
+                "a", "e", "t", "s", "r", "é", "漢", "字", "か", "な",
+                "e\xcc\x81", "\xe2\x80\x8b",
+        };
+        static const struct {
+                const char *name;
+                const char *const *pieces;
+                size_t n;
+        } samples[] = {
+                { "latin", latin, lengthof(latin) },
+                { "cjk", cjk, lengthof(cjk) },
+                { "combining", combining, lengthof(combining) },
+                { "mixed", mixed, lengthof(mixed) },
+        };
+        const size_t size = 1 << 20;
+        srand(1);
+        for (size_t i = 0; i < lengthof(samples); i++) {
+                char *s = sample(samples[i].pieces, samples[i].n, size);
+                size_t passes = 0, width = 0;
+                double start = now(), elapsed;
+                do {
+                        width += u_width(s, size);
+                        passes++;
+                } while ((elapsed = now() - start) < 0.5);
+                printf("%-10s %8.1f MB/s (%zu columns)\n", samples[i].name,
+                       passes * (double)size / elapsed / 1e6, width / passes);
+                free(s);
+        }
+}
+
+int
+main(int argc, char **argv)
+{
+        bool benchmarking;
+        test_arguments(argc, argv, &benchmarking, "", 0, 0);
+        check();
+        if (benchmarking)
+                benchmark();
+        return test_status(argv[0]);
+}
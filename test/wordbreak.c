@@ -26,12 +26,12 @@ uchar_to_utf8(uchar c, char *b)
 }
 
 static void
-output_breaks(const bool *breaks, const char *chars)
+output_breaks(const bool *breaks, const char *chars, const char *end)
 {
         const char *p;
-        for (p = chars; *p != '\0'; p = u_next(p)) {
+        for (p = chars; p < end; p = u_next(p, end)) {
                 fputs(breaks[p - chars] ? "÷" : "×", stderr);
-                fprintf(stderr, " %04X ", u_dref(p));
+                fprintf(stderr, " %04X ", u_dref(p, end));
         }
         fputs(breaks[p - chars] ? "÷" : "×", stderr);
 }
@@ -53,7 +53,7 @@ main(void)
                         char *s = strsep(&p, " \t");
                         if (*s == '#' || p == NULL)
                                 break;
-                        expected[q - chars] = u_dref(s) == 0xf7;
+                        expected[q - chars] = u_dref(s, s + strlen(s)) == 0xf7;
                         s = strsep(&p, " \t");
                         if (*s == '#' || p == NULL)
                                 break;
@@ -63,12 +63,12 @@ main(void)
                 bool actual[lengthof(expected)];
                 u_word_breaks(chars, q - chars, actual);
                 actual[q - chars] = true;
-                for (const char *r = chars; *r != '\0'; r = u_next(r))
+                for (const char *r = chars; r < q; r = u_next(r, q))
                         if (actual[r - chars] != expected[r - chars]) {
                                 failures++;
-                                output_breaks(actual, chars);
+                                output_breaks(actual, chars, q);
                                 fputs("≠", stderr);
-                                output_breaks(expected, chars);
+                                output_breaks(expected, chars, q);
                                 fputc('\n', stderr);
                                 break;
                         }